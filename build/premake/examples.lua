@@ -9,10 +9,180 @@ project "mainTest"
       "../../examples/mainTest/**.h*",
       "../../examples/mainTest/**.cpp"
    }
-   links { "xml_bindings", "xml", "mdls" }
+   links { "image", "xml_bindings", "xml", "mdls" }
    libdirs { "../../lib" }
    if _ACTION == "gmake" then
       buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- model image compiler
+project "sflight-compile"
+   kind "ConsoleApp"
+   targetname "sflight-compile"
+   targetdir "../../examples/compile"
+   debugdir "../../examples/compile"
+   files {
+      "../../examples/compile/**.h*",
+      "../../examples/compile/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- binary telemetry log converter
+project "sflight-telemetry"
+   kind "ConsoleApp"
+   targetname "sflight-telemetry"
+   targetdir "../../examples/telemetry"
+   debugdir "../../examples/telemetry"
+   files {
+      "../../examples/telemetry/**.h*",
+      "../../examples/telemetry/**.cpp"
+   }
+   links { "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- integrator error and cost benchmark
+project "sflight-integrators"
+   kind "ConsoleApp"
+   targetname "sflight-integrators"
+   targetdir "../../examples/integrators"
+   debugdir "../../examples/integrators"
+   files {
+      "../../examples/integrators/**.h*",
+      "../../examples/integrators/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- cost of the equations of motion modules
+project "sflight-eom"
+   kind "ConsoleApp"
+   targetname "sflight-eom"
+   targetdir "../../examples/eom"
+   debugdir "../../examples/eom"
+   files {
+      "../../examples/eom/**.h*",
+      "../../examples/eom/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- monte carlo dispersion runner
+project "sflight-dispersion"
+   kind "ConsoleApp"
+   targetname "sflight-dispersion"
+   targetdir "../../examples/dispersion"
+   debugdir "../../examples/dispersion"
+   files {
+      "../../examples/dispersion/**.h*",
+      "../../examples/dispersion/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- micro and end-to-end benchmarks
+project "sflight-bench"
+   kind "ConsoleApp"
+   targetname "sflight-bench"
+   targetdir "../../examples/bench"
+   debugdir "../../examples/bench"
+   files {
+      "../../examples/bench/**.h*",
+      "../../examples/bench/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- player and batch trajectory comparison
+project "sflight-batch"
+   kind "ConsoleApp"
+   targetname "sflight-batch"
+   targetdir "../../examples/batch"
+   debugdir "../../examples/batch"
+   files {
+      "../../examples/batch/**.h*",
+      "../../examples/batch/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- table interpolation equivalence checks
+project "sflight-tables"
+   kind "ConsoleApp"
+   targetname "sflight-tables"
+   targetdir "../../examples/tables"
+   debugdir "../../examples/tables"
+   files {
+      "../../examples/tables/**.h*",
+      "../../examples/tables/**.cpp"
+   }
+   links { "mdls", "xml" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+   else
+      links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
+   end
+
+-- input log record and replay check
+project "sflight-replay"
+   kind "ConsoleApp"
+   targetname "sflight-replay"
+   targetdir "../../examples/replay"
+   debugdir "../../examples/replay"
+   files {
+      "../../examples/replay/**.h*",
+      "../../examples/replay/**.cpp"
+   }
+   links { "image", "xml_bindings", "xml", "mdls" }
+   libdirs { "../../lib" }
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+      links { "pthread" }
    else
       links { "Ws2_32", "Winmm", "comctl32", "gdi32" }
    end
@@ -23,6 +23,10 @@ workspace "sflight"
    -- common include directories (all configurations/all projects)
    includedirs { "../../include" }
 
+   -- image and xml_bindings call each other (compiling a model, checking the
+   -- model of a batch), so static libraries are searched as a group
+   linkgroups "On"
+
    -- destination directory for compiled binary target
    targetdir("../../lib/")
 
@@ -41,6 +45,12 @@ workspace "sflight"
    -- common release configuration flags and symbols
    filter { "Release" }
       optimize "On"
+      -- lets the static pipelines inline module updates across files
+      flags { "LinkTimeOptimization" }
+      if _ACTION == "gmake" then
+         -- link time code generation on all cores
+         linkoptions { "-flto=auto" }
+      end
       if _ACTION ~= "gmake" then
          -- favor speed over size
          buildoptions { "/Ot" }
@@ -34,3 +34,14 @@ project "xml_bindings"
    }
    targetname "sflight_xml_bindings"
 
+-- compiled model images
+project "image"
+   kind "StaticLib"
+   if _ACTION == "gmake" then
+      buildoptions "-std=c++14"
+   end
+   files {
+      "../../include/sflight/image/**.h*",
+      "../../src/image/**.cpp"
+   }
+   targetname "sflight_image"
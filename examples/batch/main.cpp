@@ -0,0 +1,167 @@
+
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+#include "sflight/xml_bindings/builder.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/PlayerFields.hpp"
+#include "sflight/mdls/batch/BatchEOMFiveDOF.hpp"
+#include "sflight/mdls/batch/BatchFileOutput.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace sflight;
+
+namespace {
+
+// players and batch are built and flown without their printouts
+class Quiet
+{
+ public:
+   Quiet() : out(std::cout.rdbuf(nullptr)), err(std::cerr.rdbuf(nullptr)) {}
+   ~Quiet()
+   {
+      std::cout.rdbuf(out);
+      std::cerr.rdbuf(err);
+      std::cout.clear();
+      std::cerr.clear();
+   }
+
+ private:
+   std::streambuf* out{};
+   std::streambuf* err{};
+};
+
+// a player of the model; aircraft 'index' starts further north and higher
+// than aircraft 0, so every entry of a batch flies its own trajectory
+mdls::Player* build(xml::Node* const node, const std::size_t index)
+{
+   auto player{new mdls::Player()};
+   xml_bindings::builder(node, player);
+   for (std::size_t i = 0; i < player->modules.size(); i++) {
+      if (auto fileOutput = dynamic_cast<mdls::FileOutput*>(player->modules[i])) {
+         fileOutput->setFilename("");
+      }
+   }
+   player->lat += 0.001 * static_cast<double>(index);
+   player->alt += 100 * static_cast<double>(index);
+   player->paused = false;
+   return player;
+}
+
+bool same(const double a, const double b) { return std::memcmp(&a, &b, sizeof(a)) == 0; }
+
+// flies the model as separate players and as one batch, and compares every
+// field of every aircraft after each frame
+bool check(const std::string& filename, const std::size_t frames, const std::size_t aircraft)
+{
+   xml::Document document;
+   std::vector<mdls::Player*> players;
+   mdls::PlayerBatch batch;
+   bool built{};
+   {
+      Quiet quiet;
+      if (document.load(filename)) {
+         xml::Node* const root{document.getRoot()};
+         built = xml_bindings::builder(root, &batch, 0);
+         for (std::size_t i = 0; built && i < aircraft; i++) {
+            players.push_back(build(root, i));
+            mdls::Player* const entry{build(root, i)};
+            batch.add(entry);
+            delete entry;
+         }
+      }
+   }
+   if (!built) {
+      std::cout << filename << " : could not be built as a batch" << std::endl;
+      return false;
+   }
+   for (std::size_t i = 0; i < batch.modules.size(); i++) {
+      if (auto fileOutput = dynamic_cast<mdls::BatchFileOutput*>(batch.modules[i])) {
+         fileOutput->setFilename("");
+      }
+      // the vectorized kernels agree with EOMFiveDOF only to rounding
+      if (auto eom = dynamic_cast<mdls::BatchEOMFiveDOF*>(batch.modules[i])) {
+         eom->setInstructionSet(mdls::simd::InstructionSet::SCALAR);
+      }
+   }
+   batch.paused = false;
+
+   const std::vector<mdls::PlayerField>& fields{mdls::getPlayerFields()};
+   const double frameTime{1.0 / 60};
+   mdls::Player entry;
+   bool good{true};
+   for (std::size_t frame = 0; good && frame < frames; frame++) {
+      {
+         Quiet quiet;
+         for (std::size_t i = 0; i < players.size(); i++) {
+            players[i]->update(frameTime);
+         }
+         batch.update(frameTime);
+      }
+      for (std::size_t i = 0; good && i < players.size(); i++) {
+         batch.get(i, &entry);
+         for (std::size_t j = 0; j < fields.size(); j++) {
+            const double x{fields[j].get(*players[i])};
+            const double y{fields[j].get(entry)};
+            if (!same(x, y)) {
+               std::cout << filename << " : aircraft " << i << " differs on frame " << frame
+                         << " in " << fields[j].name << std::setprecision(17) << " ("
+                         << x << " player, " << y << " batch)" << std::endl;
+               good = false;
+               break;
+            }
+         }
+      }
+   }
+   for (std::size_t i = 0; i < players.size(); i++) {
+      delete players[i];
+   }
+   if (good) {
+      std::cout << filename << " : " << aircraft << " aircraft identical over " << frames
+                << " frames" << std::endl;
+   }
+   return good;
+}
+}
+
+int main(int argc, char** argv)
+{
+   std::size_t frames{36000};
+   std::size_t aircraft{4};
+   std::vector<std::string> models;
+   for (int i = 1; i < argc; i++) {
+      const std::string arg{argv[i]};
+      const bool more{i + 1 < argc};
+      if (arg == "--frames" && more) {
+         frames = static_cast<std::size_t>(std::atol(argv[++i]));
+      } else if (arg == "--aircraft" && more) {
+         aircraft = static_cast<std::size_t>(std::atol(argv[++i]));
+      } else if (arg.compare(0, 2, "--") != 0) {
+         models.push_back(arg);
+      } else {
+         std::cout << "usage: sflight-batch [--frames <frames>] [--aircraft <aircraft>] "
+                      "[model files]"
+                   << std::endl;
+         return 1;
+      }
+   }
+   if (models.empty()) {
+      models.push_back("../mainTest/example1.xml");
+      models.push_back("../mainTest/example2.xml");
+   }
+
+   // every field of every aircraft must match bit for bit
+   bool good{true};
+   for (std::size_t i = 0; i < models.size(); i++) {
+      good = check(models[i], frames, aircraft) && good;
+   }
+   return good ? 0 : 1;
+}
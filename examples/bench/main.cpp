@@ -0,0 +1,456 @@
+
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+#include "sflight/xml/parser_utils.hpp"
+
+#include "sflight/xml_bindings/builder.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/Table2D.hpp"
+#include "sflight/mdls/Table3D.hpp"
+#include "sflight/mdls/Vector3.hpp"
+#include "sflight/mdls/batch/BatchFileOutput.hpp"
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/mdls/modules/EOMFiveDOF.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sflight;
+
+namespace {
+
+// results are added here so the compiler cannot drop the work measured
+volatile double sink{};
+
+//------------------------------------------------------------------------------
+// Class: Result
+// Description: One benchmark: nanoseconds per operation, and for fleets the
+//              number of aircraft an operation advances by one frame.
+//------------------------------------------------------------------------------
+class Result
+{
+ public:
+   std::string name;
+   double nsPerOp{};
+   std::size_t aircraft{};
+};
+
+//------------------------------------------------------------------------------
+// Class: Bench
+// Description: Times operations: the repeat count is raised until one timing
+//              takes a tenth of the time allowed, and the best of five timings
+//              is kept, which is the least disturbed by the rest of the machine.
+//------------------------------------------------------------------------------
+class Bench
+{
+ public:
+   explicit Bench(const double seconds) : seconds(seconds) {}
+
+   // 'op(i)' is one operation; 'i' counts up from 0 across calls
+   template <class F>
+   void run(const std::string& name, F op, const std::size_t aircraft = 0)
+   {
+      using Clock = std::chrono::steady_clock;
+      std::uint64_t i{};
+      auto timeOf = [&](const std::uint64_t n) {
+         double sum{};
+         const Clock::time_point start{Clock::now()};
+         for (std::uint64_t k = 0; k < n; k++) {
+            sum += op(i++);
+         }
+         const Clock::time_point end{Clock::now()};
+         sink = sink + sum;
+         return std::chrono::duration<double>(end - start).count();
+      };
+
+      std::uint64_t n{1};
+      while (timeOf(n) < seconds / 10 && n < (std::uint64_t(1) << 40)) {
+         n *= 2;
+      }
+      double best{timeOf(n)};
+      for (int rep = 1; rep < 5; rep++) {
+         best = std::min(best, timeOf(n));
+      }
+
+      Result x;
+      x.name = name;
+      x.nsPerOp = best * 1e9 / static_cast<double>(n);
+      x.aircraft = aircraft;
+      results.push_back(x);
+
+      const auto flags = std::cout.flags();
+      const auto precision = std::cout.precision();
+      std::cout << std::left << std::setw(32) << name << std::right << std::fixed
+                << std::setprecision(2) << std::setw(16) << x.nsPerOp << " ns/op";
+      if (aircraft > 0) {
+         std::cout << std::setprecision(0) << std::setw(14) << 1e9 / x.nsPerOp
+                   << " frames/s" << std::setw(16) << 1e9 * aircraft / x.nsPerOp
+                   << " aircraft-frames/s";
+      }
+      std::cout << std::endl;
+      std::cout.flags(flags);
+      std::cout.precision(precision);
+   }
+
+   const std::vector<Result>& getResults() const             { return results; }
+
+ private:
+   double seconds{};
+   std::vector<Result> results;
+};
+
+// random inputs, cycled through by the benchmarks (a power of two long)
+std::vector<double> inputs(const double low, const double high, const unsigned seed)
+{
+   std::mt19937_64 rng(seed);
+   std::uniform_real_distribution<double> uniform(low, high);
+   std::vector<double> x(4096);
+   for (std::size_t i = 0; i < x.size(); i++) {
+      x[i] = uniform(rng);
+   }
+   return x;
+}
+
+double* breakpoints(const std::size_t n, const double low, const double step)
+{
+   double* x{new double[n]};
+   for (std::size_t i = 0; i < n; i++) {
+      x[i] = low + static_cast<double>(i) * step;
+   }
+   return x;
+}
+
+// a smooth table of the usual aero size: alpha by mach
+mdls::Table2D* makeTable2D()
+{
+   const std::size_t rows{30};
+   const std::size_t cols{12};
+   auto table =
+       new mdls::Table2D(rows, cols, breakpoints(rows, -10, 1), breakpoints(cols, 0, 0.1));
+   for (std::size_t i = 0; i < rows; i++) {
+      for (std::size_t j = 0; j < cols; j++) {
+         table->set(i, j, 0.1 * static_cast<double>(i) + 0.01 * static_cast<double>(j * j));
+      }
+   }
+   return table;
+}
+
+// builds a player or batch without the builders' printouts
+template <class T>
+void build(xml::Node* const node, T* const x)
+{
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+   xml_bindings::builder(node, x);
+   std::cout.rdbuf(out);
+   std::cout.clear();
+}
+
+// as above, with no file output, which would time the disk
+bool build(xml::Node* const node, mdls::PlayerBatch* const x, const std::size_t count)
+{
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+   const bool built{xml_bindings::builder(node, x, count)};
+   std::cout.rdbuf(out);
+   std::cout.clear();
+   for (std::size_t i = 0; i < x->modules.size(); i++) {
+      if (auto fileOutput = dynamic_cast<mdls::BatchFileOutput*>(x->modules[i])) {
+         fileOutput->setFilename("");
+      }
+   }
+   return built;
+}
+
+void writeJson(std::ostream& out, const std::vector<Result>& results)
+{
+   out << "{\n  \"benchmarks\": [\n";
+   out << std::setprecision(6);
+   for (std::size_t i = 0; i < results.size(); i++) {
+      const Result& x{results[i]};
+      out << "    {\"name\": \"" << x.name << "\", \"ns_per_op\": " << x.nsPerOp
+          << ", \"ops_per_sec\": " << 1e9 / x.nsPerOp;
+      if (x.aircraft > 0) {
+         out << ", \"aircraft\": " << x.aircraft
+             << ", \"frames_per_sec\": " << 1e9 / x.nsPerOp
+             << ", \"aircraft_frames_per_sec\": " << 1e9 * x.aircraft / x.nsPerOp;
+      }
+      out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+   }
+   out << "  ]\n}\n";
+}
+
+// reads back the names and ns_per_op values of a file written by writeJson
+bool readJson(const std::string& filename, std::vector<Result>& results)
+{
+   std::ifstream in(filename.c_str());
+   if (!in) {
+      return false;
+   }
+   std::stringstream buffer;
+   buffer << in.rdbuf();
+   const std::string text{buffer.str()};
+
+   const std::string nameKey{"\"name\": \""};
+   const std::string nsKey{"\"ns_per_op\": "};
+   std::size_t pos{};
+   while ((pos = text.find(nameKey, pos)) != std::string::npos) {
+      pos += nameKey.size();
+      const std::size_t end{text.find('"', pos)};
+      const std::size_t ns{text.find(nsKey, pos)};
+      if (end == std::string::npos || ns == std::string::npos) {
+         return false;
+      }
+      Result x;
+      x.name = text.substr(pos, end - pos);
+      x.nsPerOp = std::atof(text.c_str() + ns + nsKey.size());
+      results.push_back(x);
+      pos = ns;
+   }
+   return true;
+}
+}
+
+int main(int argc, char** argv)
+{
+   std::string models{"../mainTest"};
+   std::string jsonFile{"bench.json"};
+   std::string baselineFile;
+   double tolerance{0.25};
+   double seconds{0.2};
+   std::size_t maxFleet{100000};
+   for (int i = 1; i < argc; i++) {
+      const std::string arg{argv[i]};
+      const bool more{i + 1 < argc};
+      if (arg == "--models" && more) {
+         models = argv[++i];
+      } else if (arg == "--json" && more) {
+         jsonFile = argv[++i];
+      } else if (arg == "--baseline" && more) {
+         baselineFile = argv[++i];
+      } else if (arg == "--tolerance" && more) {
+         tolerance = std::atof(argv[++i]);
+      } else if (arg == "--time" && more) {
+         seconds = std::atof(argv[++i]);
+      } else if (arg == "--max-fleet" && more) {
+         maxFleet = static_cast<std::size_t>(std::atol(argv[++i]));
+      } else {
+         std::cout << "usage: sflight-bench [--models <dir>] [--json <file>] "
+                      "[--baseline <file>] [--tolerance <fraction>] [--time <sec>] "
+                      "[--max-fleet <aircraft>]"
+                   << std::endl;
+         return 1;
+      }
+   }
+   const std::string example1{models + "/example1.xml"};
+   const std::string example2{models + "/example2.xml"};
+
+   Bench bench(seconds);
+
+   // tables
+   {
+      mdls::Table2D* table2D{makeTable2D()};
+      const std::size_t pages{8};
+      mdls::Table3D table3D(pages, breakpoints(pages, 0, 5000));
+      std::vector<mdls::Table2D*> tables;
+      for (std::size_t i = 0; i < pages; i++) {
+         tables.push_back(makeTable2D());
+         tables[i]->multiply(1 + 0.1 * static_cast<double>(i));
+         table3D.setPage(i, tables[i]);
+      }
+      const std::vector<double> alpha{inputs(-10, 19, 1)};
+      const std::vector<double> mach{inputs(0, 1.1, 2)};
+      const std::vector<double> alt{inputs(0, 35000, 3)};
+
+      bench.run("table2d.interp", [&](const std::uint64_t i) {
+         return table2D->interp(alpha[i & 4095], mach[i & 4095]);
+      });
+      bench.run("table3d.interp", [&](const std::uint64_t i) {
+         return table3D.interp(alt[i & 4095], alpha[i & 4095], mach[i & 4095]);
+      });
+      delete table2D;
+      for (std::size_t i = 0; i < tables.size(); i++) {
+         delete tables[i];
+      }
+   }
+
+   // atmosphere
+   {
+      const std::vector<double> alt{inputs(0, 20000, 4)};
+      using mdls::Atmosphere;
+      bench.run("atmosphere.getTemp",
+                [&](const std::uint64_t i) { return Atmosphere::getTemp(alt[i & 4095]); });
+      bench.run("atmosphere.getRho",
+                [&](const std::uint64_t i) { return Atmosphere::getRho(alt[i & 4095]); });
+      bench.run("atmosphere.getPressure",
+                [&](const std::uint64_t i) { return Atmosphere::getPressure(alt[i & 4095]); });
+      bench.run("atmosphere.getAll",
+                [&](const std::uint64_t i) { return Atmosphere::getAll(alt[i & 4095]).rho; });
+      bench.run("atmosphere.getAllISA",
+                [&](const std::uint64_t i) { return Atmosphere::getAllISA(alt[i & 4095]).rho; });
+   }
+
+   // navigation
+   {
+      const std::vector<double> lat{inputs(-1.2, 1.2, 5)};
+      const std::vector<double> lon{inputs(-3.1, 3.1, 6)};
+      const std::vector<double> vel{inputs(-250, 250, 7)};
+      using namespace mdls::nav;
+      bench.run("nav.wgs84LatLon", [&](const std::uint64_t i) {
+         double x{lat[i & 4095]};
+         double y{lon[i & 4095]};
+         wgs84LatLon(&x, &y, 10000, vel[i & 4095], vel[(i + 1) & 4095], 1.0 / 60);
+         return x + y;
+      });
+      bench.run("nav.simpleLatLon", [&](const std::uint64_t i) {
+         double x{lat[i & 4095]};
+         double y{lon[i & 4095]};
+         simpleLatLon(&x, &y, 10000, vel[i & 4095], vel[(i + 1) & 4095], 1.0 / 60);
+         return x + y;
+      });
+      bench.run("nav.distance", [&](const std::uint64_t i) {
+         return distance(lat[i & 4095], lon[i & 4095], lat[(i + 1) & 4095], lon[(i + 1) & 4095]);
+      });
+      bench.run("nav.headingBetween", [&](const std::uint64_t i) {
+         return headingBetween(lat[i & 4095], lon[i & 4095], lat[(i + 1) & 4095],
+                               lon[(i + 1) & 4095]);
+      });
+      bench.run("nav.getG", [&](const std::uint64_t i) {
+         return getG(lat[i & 4095], lon[i & 4095], 10000);
+      });
+      bench.run("nav.getGravForce", [&](const std::uint64_t i) {
+         mdls::Vector3 v;
+         getGravForce(&v, lat[i & 4095], lon[i & 4095], gravEq);
+         return v.get3();
+      });
+   }
+
+   // xml
+   for (const std::string& file : {example1, example2}) {
+      const std::string name{file.substr(file.find_last_of("/\\") + 1)};
+      bench.run("xml.parse/" + name, [&](const std::uint64_t) {
+         std::streambuf* const out{std::cout.rdbuf(nullptr)};
+         xml::Node* node{xml::parse(file)};
+         std::cout.rdbuf(out);
+         std::cout.clear();
+         const double x{node != nullptr ? static_cast<double>(node->getChildCount()) : 0};
+         delete node;
+         return x;
+      });
+      bench.run("xml.Document.load/" + name, [&](const std::uint64_t) {
+         std::streambuf* const out{std::cout.rdbuf(nullptr)};
+         xml::Document document;
+         const bool loaded{document.load(file)};
+         std::cout.rdbuf(out);
+         std::cout.clear();
+         return loaded ? static_cast<double>(document.getRoot()->getChildCount()) : 0;
+      });
+   }
+
+   xml::Document document;
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+   const bool loaded{document.load(example1)};
+   std::cout.rdbuf(out);
+   std::cout.clear();
+   if (!loaded) {
+      std::cout << "Configuration file FAILED parsing: " << example1 << std::endl;
+      return 1;
+   }
+
+   // equations of motion alone, with a timestep short enough that the state
+   // stays put however many times it runs
+   {
+      mdls::Player player;
+      build(document.getRoot(), &player);
+      mdls::EOMFiveDOF* eom{};
+      for (std::size_t i = 0; i < player.modules.size() && eom == nullptr; i++) {
+         eom = dynamic_cast<mdls::EOMFiveDOF*>(player.modules[i]);
+      }
+      if (eom != nullptr) {
+         const double weight{player.mass * mdls::nav::gravEq};
+         player.aeroForce = mdls::Vector3(-0.05 * weight, 0, -weight);
+         player.thrust = mdls::Vector3(0.05 * weight, 0, 0);
+         bench.run("eom5.computeEOM", [&](const std::uint64_t) {
+            eom->computeEOM(1e-9);
+            return player.alt;
+         });
+      }
+   }
+
+   // a whole frame of the example model, output files left out
+   {
+      mdls::Player player;
+      build(document.getRoot(), &player);
+      for (std::size_t i = 0; i < player.modules.size(); i++) {
+         auto fileOutput = dynamic_cast<mdls::FileOutput*>(player.modules[i]);
+         if (fileOutput != nullptr) {
+            fileOutput->setFilename("");
+         }
+      }
+      player.paused = false;
+      bench.run("player.update/example1.xml", [&](const std::uint64_t) {
+         player.update(1.0 / 60);
+         return player.alt;
+      }, 1);
+   }
+
+   // fleets: one batch update advances every aircraft by a frame
+   {
+      xml::Document fleetDocument;
+      std::cout.rdbuf(nullptr);
+      const bool fleetLoaded{fleetDocument.load(example2)};
+      std::cout.rdbuf(out);
+      std::cout.clear();
+      for (std::size_t n = 1; fleetLoaded && n <= maxFleet; n *= 10) {
+         mdls::PlayerBatch batch;
+         if (!build(fleetDocument.getRoot(), &batch, n)) {
+            std::cout << "Fleet could not be built from " << example2 << std::endl;
+            break;
+         }
+         batch.paused = false;
+         bench.run("fleet.update/" + std::to_string(n), [&](const std::uint64_t) {
+            batch.update(1.0 / 60);
+            return batch.alt[0];
+         }, n);
+      }
+   }
+
+   std::ofstream json(jsonFile.c_str());
+   writeJson(json, bench.getResults());
+   std::cout << "Results written to " << jsonFile << std::endl;
+
+   if (baselineFile.empty()) {
+      return 0;
+   }
+   std::vector<Result> baseline;
+   if (!readJson(baselineFile, baseline)) {
+      std::cout << "Baseline could not be read: " << baselineFile << std::endl;
+      return 1;
+   }
+   std::size_t regressions{};
+   for (const Result& x : bench.getResults()) {
+      for (const Result& base : baseline) {
+         if (base.name == x.name && base.nsPerOp > 0 &&
+             x.nsPerOp > base.nsPerOp * (1 + tolerance)) {
+            std::cout << "REGRESSION " << x.name << ": " << x.nsPerOp << " ns/op against "
+                      << base.nsPerOp << " ns/op" << std::endl;
+            regressions++;
+         }
+      }
+   }
+   std::cout << regressions << " regressions beyond " << tolerance * 100 << "% of "
+             << baselineFile << std::endl;
+   return regressions == 0 ? 0 : 1;
+}
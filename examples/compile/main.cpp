@@ -0,0 +1,28 @@
+
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+
+#include "sflight/image/compile.hpp"
+
+#include <iostream>
+#include <string>
+
+using namespace sflight;
+
+int main(int argc, char** argv)
+{
+   if (argc < 3) {
+      std::cout << "usage: sflight-compile <input file> <output image>" << std::endl;
+      return 1;
+   }
+   const std::string filename{argv[1]};
+   const std::string imageFilename{argv[2]};
+
+   xml::Document document;
+   if (!document.load(filename)) {
+      std::cout << "Configuration file FAILED parsing!\n";
+      return 1;
+   }
+
+   return image::compile(document.getRoot(), imageFilename) ? 0 : 1;
+}
@@ -0,0 +1,459 @@
+
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
+#include "sflight/xml/node_utils.hpp"
+
+#include "sflight/xml_bindings/builder.hpp"
+
+#include "sflight/mdls/Euler.hpp"
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/UnitConvert.hpp"
+#include "sflight/mdls/constants.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
+#include "sflight/mdls/modules/TableAero.hpp"
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sflight;
+
+namespace {
+namespace paths {
+const xml::Path runs{"Runs"};
+const xml::Path seed{"Seed"};
+const xml::Path time{"Time"};
+const xml::Path rate{"Rate"};
+const xml::Path modulesRate{"Modules/Rate"};
+const xml::Path sigma{"Sigma"};
+const xml::Path min{"Min"};
+const xml::Path max{"Max"};
+const xml::Path latitude{"Latitude"};
+const xml::Path longitude{"Longitude"};
+const xml::Path altitude{"Altitude"};
+const xml::Path heading{"Heading"};
+const xml::Path pitch{"Pitch"};
+const xml::Path airspeed{"Airspeed"};
+const xml::Path weight{"Weight"};
+const xml::Path fuel{"Fuel"};
+const xml::Path windSpeed{"WindSpeed"};
+const xml::Path windDirection{"WindDirection"};
+const xml::Path wind{"Wind"};
+const xml::Path speed{"Speed"};
+const xml::Path direction{"Direction"};
+const xml::Path liftScale{"LiftScale"};
+const xml::Path dragScale{"DragScale"};
+const xml::Path thrustScale{"ThrustScale"};
+const xml::Path fuelflowScale{"FuelFlowScale"};
+}
+
+//------------------------------------------------------------------------------
+// Class: Dispersion
+// Description: A random offset: normal with the given sigma, or uniform
+//              between min and max.  Draws are made from the raw bits of the
+//              generator, so a seed gives the same offsets with any standard
+//              library.
+//------------------------------------------------------------------------------
+class Dispersion
+{
+ public:
+   enum class Kind { NONE, NORMAL, UNIFORM };
+
+   // <Name Sigma=".."/> or <Name Min=".." Max=".."/> under 'node'
+   void read(xml::Node* const node, const xml::Path& path)
+   {
+      xml::Node* const x{path.resolve(node)};
+      if (x == nullptr) {
+         return;
+      }
+      if (paths::sigma.resolve(x) != nullptr) {
+         kind = Kind::NORMAL;
+         a = xml::getDouble(x, paths::sigma, 0.0);
+      } else {
+         kind = Kind::UNIFORM;
+         a = xml::getDouble(x, paths::min, 0.0);
+         b = xml::getDouble(x, paths::max, 0.0);
+      }
+   }
+
+   bool isSet() const                           { return kind != Kind::NONE; }
+
+   double draw(std::mt19937_64& rng) const
+   {
+      switch (kind) {
+      case Kind::NORMAL: {
+         // Box-Muller; u1 is kept off zero
+         const double u1{1.0 - uniform(rng)};
+         const double u2{uniform(rng)};
+         return a * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * mdls::math::PI * u2);
+      }
+      case Kind::UNIFORM:
+         return a + (b - a) * uniform(rng);
+      default:
+         return 0;
+      }
+   }
+
+ private:
+   // in [0, 1), from the top 53 bits
+   static double uniform(std::mt19937_64& rng)
+   {
+      return static_cast<double>(rng() >> 11) * (1.0 / 9007199254740992.0);
+   }
+
+   Kind kind{Kind::NONE};
+   double a{};
+   double b{};
+};
+
+//------------------------------------------------------------------------------
+// Class: Dispersions
+// Description: What varies between runs, in the units of the model file, and
+//              how the runs are made.  Scale factors are offsets from 1.
+//------------------------------------------------------------------------------
+class Dispersions
+{
+ public:
+   void read(xml::Node* const node, xml::Node* const model)
+   {
+      runs = static_cast<std::size_t>(xml::getLong(node, paths::runs, 1000));
+      seed = static_cast<std::uint64_t>(xml::getLong(node, paths::seed, 1));
+      time = xml::getDouble(node, paths::time, 600.0);
+      rate = xml::getDouble(node, paths::rate, xml::getDouble(model, paths::modulesRate, 60.0));
+
+      latitude.read(node, paths::latitude);
+      longitude.read(node, paths::longitude);
+      altitude.read(node, paths::altitude);
+      heading.read(node, paths::heading);
+      pitch.read(node, paths::pitch);
+      airspeed.read(node, paths::airspeed);
+      weight.read(node, paths::weight);
+      fuel.read(node, paths::fuel);
+      windSpeed.read(node, paths::windSpeed);
+      windDirection.read(node, paths::windDirection);
+      liftScale.read(node, paths::liftScale);
+      dragScale.read(node, paths::dragScale);
+      thrustScale.read(node, paths::thrustScale);
+      fuelflowScale.read(node, paths::fuelflowScale);
+
+      // the wind the model starts with, as init_Player reads it
+      xml::Node* const x{paths::wind.resolve(model)};
+      nominalWindSpeed = xml::getDouble(x, paths::speed, 0.0);
+      nominalWindDirection = xml::getDouble(x, paths::direction, 0.0);
+   }
+
+   // perturbs a player built from the model; every offset is drawn, in a fixed
+   // order, whether it is used or not
+   void apply(mdls::Player* player, std::mt19937_64& rng) const
+   {
+      using mdls::UnitConvert;
+      player->lat += UnitConvert::toRads(latitude.draw(rng));
+      player->lon += UnitConvert::toRads(longitude.draw(rng));
+      player->alt += UnitConvert::toMeters(altitude.draw(rng));
+
+      mdls::Euler eulers{player->getEulers()};
+      eulers.setPsi(eulers.getPsi() + UnitConvert::toRads(heading.draw(rng)));
+      eulers.setTheta(eulers.getTheta() + UnitConvert::toRads(pitch.draw(rng)));
+      player->setEulers(eulers);
+      player->uvw.set1(player->uvw.get1() + UnitConvert::toMPS(airspeed.draw(rng)));
+      eulers.getDxDyDz(player->nedVel, player->uvw);
+
+      player->mass += UnitConvert::toKilos(weight.draw(rng));
+      player->fuel += UnitConvert::toKilos(fuel.draw(rng));
+
+      const double wspeed{UnitConvert::toMPS(nominalWindSpeed + windSpeed.draw(rng))};
+      const double dir{UnitConvert::toRads(nominalWindDirection + windDirection.draw(rng) + 180)};
+      if (windSpeed.isSet() || windDirection.isSet()) {
+         player->windVel.set1(wspeed * std::cos(dir));
+         player->windVel.set2(wspeed * std::sin(dir));
+         player->windVel.set3(0);
+      }
+
+      const double lift{1 + liftScale.draw(rng)};
+      const double drag{1 + dragScale.draw(rng)};
+      const double thrust{1 + thrustScale.draw(rng)};
+      const double fuelflow{1 + fuelflowScale.draw(rng)};
+      for (std::size_t i = 0; i < player->modules.size(); i++) {
+         auto aero = dynamic_cast<mdls::TableAero*>(player->modules[i]);
+         if (aero != nullptr) {
+            aero->getLiftTable()->multiply(lift);
+            aero->getDragTable()->multiply(drag);
+            aero->getThrustTable()->multiply(thrust);
+            aero->getFuelflowTable()->multiply(fuelflow);
+         }
+      }
+   }
+
+   bool hasScales() const
+   {
+      return liftScale.isSet() || dragScale.isSet() || thrustScale.isSet() ||
+             fuelflowScale.isSet();
+   }
+
+   std::size_t runs{1000};
+   std::uint64_t seed{1};
+   double time{600};
+   double rate{60};
+
+ private:
+   Dispersion latitude;      // degrees
+   Dispersion longitude;     // degrees
+   Dispersion altitude;      // feet
+   Dispersion heading;       // degrees
+   Dispersion pitch;         // degrees
+   Dispersion airspeed;      // knots
+   Dispersion weight;        // lbs
+   Dispersion fuel;          // lbs
+   Dispersion windSpeed;     // knots
+   Dispersion windDirection; // degrees
+   Dispersion liftScale;
+   Dispersion dragScale;
+   Dispersion thrustScale;
+   Dispersion fuelflowScale;
+
+   double nominalWindSpeed{};
+   double nominalWindDirection{};
+};
+
+//------------------------------------------------------------------------------
+// Class: Statistic
+// Description: Running moments of a quantity, and its value for each run for
+//              the percentiles; nothing is kept of the trajectories.
+//------------------------------------------------------------------------------
+class Statistic
+{
+ public:
+   void add(const double x)
+   {
+      const double delta{x - mean};
+      values.push_back(x);
+      mean += delta / static_cast<double>(values.size());
+      m2 += delta * (x - mean);
+   }
+
+   double getMean() const                       { return mean; }
+   double getSigma() const
+   {
+      return values.size() > 1 ? std::sqrt(m2 / static_cast<double>(values.size() - 1)) : 0;
+   }
+
+   // nearest rank; 0 is the smallest value, 1 the largest
+   double getPercentile(const double fraction)
+   {
+      if (values.empty()) {
+         return 0;
+      }
+      if (!sorted) {
+         std::sort(values.begin(), values.end());
+         sorted = true;
+      }
+      const double rank{std::ceil(fraction * static_cast<double>(values.size()))};
+      return values[static_cast<std::size_t>(std::max(rank, 1.0)) - 1];
+   }
+
+ private:
+   double mean{};
+   double m2{};
+   std::vector<double> values;
+   bool sorted{};
+};
+
+// the end of one run
+class Outcome
+{
+ public:
+   double lat{};
+   double lon{};
+   double alt{};
+   double minAlt{};
+   double fuelBurned{};
+};
+
+//------------------------------------------------------------------------------
+// Class: Results
+// Description: The aggregate of any number of runs, measured against the
+//              undispersed (nominal) run.
+//------------------------------------------------------------------------------
+class Results
+{
+ public:
+   void add(const Outcome& x, const Outcome& nominal)
+   {
+      using mdls::UnitConvert;
+      const double north{(x.lat - nominal.lat) * mdls::nav::radiusEq};
+      const double east{(x.lon - nominal.lon) * mdls::nav::radiusEq * std::cos(nominal.lat)};
+      miss.add(std::sqrt(north * north + east * east));
+      finalAlt.add(UnitConvert::toFeet(x.alt));
+      minAlt.add(UnitConvert::toFeet(x.minAlt));
+      fuelBurned.add(UnitConvert::toLbs(x.fuelBurned));
+      if (x.minAlt <= 0) {
+         belowSeaLevel++;
+      }
+   }
+
+   // final distance from the nominal end point (meters)
+   Statistic miss;
+   // altitudes (feet) and fuel (lbs)
+   Statistic finalAlt;
+   Statistic minAlt;
+   Statistic fuelBurned;
+   std::size_t belowSeaLevel{};
+};
+
+// flies the model once; run 0 is not dispersed
+Outcome fly(xml::Node* const model, const Dispersions& dispersions, const std::size_t run,
+            const bool nominal)
+{
+   mdls::Player player;
+   xml_bindings::builder(model, &player);
+
+   // runs write no output files
+   for (std::size_t i = 0; i < player.modules.size(); i++) {
+      auto fileOutput = dynamic_cast<mdls::FileOutput*>(player.modules[i]);
+      if (fileOutput != nullptr) {
+         fileOutput->setFilename("");
+      }
+   }
+
+   if (!nominal) {
+      // one stream per run, whichever thread makes it
+      std::seed_seq seq{static_cast<std::uint32_t>(dispersions.seed),
+                        static_cast<std::uint32_t>(dispersions.seed >> 32),
+                        static_cast<std::uint32_t>(run),
+                        static_cast<std::uint32_t>(static_cast<std::uint64_t>(run) >> 32)};
+      std::mt19937_64 rng(seq);
+      dispersions.apply(&player, rng);
+   }
+   player.paused = false;
+
+   Outcome x;
+   const double fuel{player.fuel};
+   x.minAlt = player.alt;
+   const double frameTime{1.0 / dispersions.rate};
+   const std::size_t frames{static_cast<std::size_t>(dispersions.time * dispersions.rate)};
+   for (std::size_t i = 0; i < frames; i++) {
+      player.update(frameTime);
+      x.minAlt = std::min(x.minAlt, player.alt);
+   }
+   x.lat = player.lat;
+   x.lon = player.lon;
+   x.alt = player.alt;
+   x.fuelBurned = fuel - player.fuel;
+   return x;
+}
+
+void print(const char* const name, Statistic& x)
+{
+   std::cout << std::left << std::setw(18) << name << std::right << std::fixed
+             << std::setprecision(1) << std::setw(12) << x.getMean() << std::setw(12)
+             << x.getSigma() << std::setw(12) << x.getPercentile(0) << std::setw(12)
+             << x.getPercentile(0.05) << std::setw(12) << x.getPercentile(0.5) << std::setw(12)
+             << x.getPercentile(0.95) << std::setw(12) << x.getPercentile(1)
+             << std::defaultfloat << std::endl;
+}
+}
+
+int main(int argc, char** argv)
+{
+   if (argc < 3) {
+      std::cout << "usage: sflight-dispersion <model file> <dispersion file> [runs] [threads]"
+                << std::endl;
+      return 1;
+   }
+
+   xml::Document model;
+   xml::Document document;
+   if (!model.load(argv[1]) || !document.load(argv[2])) {
+      std::cout << "Configuration FAILED parsing!\n";
+      return 1;
+   }
+   Dispersions dispersions;
+   dispersions.read(document.getRoot(), model.getRoot());
+   if (argc > 3) {
+      dispersions.runs = static_cast<std::size_t>(std::atol(argv[3]));
+   }
+   const std::size_t numThreads{std::max<std::size_t>(
+       1, argc > 4 ? static_cast<std::size_t>(std::atoi(argv[4]))
+                   : std::thread::hardware_concurrency())};
+   if (dispersions.rate <= 0 || dispersions.time <= 0) {
+      std::cout << "Dispersions need a positive time and rate" << std::endl;
+      return 1;
+   }
+
+   // the builders' printouts are not wanted here
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+
+   const Outcome nominal{fly(model.getRoot(), dispersions, 0, true)};
+   bool hasTables{};
+   {
+      mdls::Player player;
+      xml_bindings::builder(model.getRoot(), &player);
+      for (std::size_t i = 0; i < player.modules.size(); i++) {
+         hasTables = hasTables || dynamic_cast<mdls::TableAero*>(player.modules[i]) != nullptr;
+      }
+   }
+
+   // the threads take the next run to make, all building from the one model
+   // tree; the outcomes are added up in run order afterwards, so a seed gives
+   // the same totals with any number of threads
+   std::vector<Outcome> outcomes(dispersions.runs);
+   std::atomic<std::size_t> nextRun{};
+   const auto start = std::chrono::steady_clock::now();
+   std::vector<std::thread> threads;
+   for (std::size_t t = 0; t < numThreads; t++) {
+      threads.emplace_back([&]() {
+         for (std::size_t i = nextRun++; i < outcomes.size(); i = nextRun++) {
+            outcomes[i] = fly(model.getRoot(), dispersions, i + 1, false);
+         }
+      });
+   }
+   for (std::size_t t = 0; t < threads.size(); t++) {
+      threads[t].join();
+   }
+   const auto end = std::chrono::steady_clock::now();
+
+   std::cout.rdbuf(out);
+   std::cout.clear();
+
+   Results total;
+   for (std::size_t i = 0; i < outcomes.size(); i++) {
+      total.add(outcomes[i], nominal);
+   }
+
+   if (dispersions.hasScales() && !hasTables) {
+      std::cout << "Note: the model has no TableAero module; table scale factors are ignored"
+                << std::endl;
+   }
+   const double seconds{std::chrono::duration<double>(end - start).count()};
+   std::cout << dispersions.runs << " runs of " << dispersions.time << " s at "
+             << dispersions.rate << " Hz, seed " << dispersions.seed << ", " << numThreads
+             << " threads: " << std::setprecision(3) << seconds << " s ("
+             << dispersions.runs / seconds << " runs/s)" << std::endl;
+   std::cout << std::setprecision(6) << "Nominal end point : lat "
+             << mdls::UnitConvert::toDegs(nominal.lat) << ", lon "
+             << mdls::UnitConvert::toDegs(nominal.lon) << ", alt "
+             << mdls::UnitConvert::toFeet(nominal.alt) << " ft" << std::endl
+             << std::endl;
+
+   std::cout << std::left << std::setw(18) << "" << std::right << std::setw(12) << "mean"
+             << std::setw(12) << "sigma" << std::setw(12) << "min" << std::setw(12) << "p5"
+             << std::setw(12) << "p50" << std::setw(12) << "p95" << std::setw(12) << "max"
+             << std::endl;
+   print("miss (m)", total.miss);
+   print("final alt (ft)", total.finalAlt);
+   print("min alt (ft)", total.minAlt);
+   print("fuel burned (lbs)", total.fuelBurned);
+   std::cout << "Runs reaching sea level: " << total.belowSeaLevel << std::endl;
+   return 0;
+}
@@ -0,0 +1,107 @@
+
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+
+#include "sflight/xml_bindings/init_EOMFiveDOF.hpp"
+#include "sflight/xml_bindings/init_EOMSixDOF.hpp"
+#include "sflight/xml_bindings/init_Player.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/EOMFiveDOF.hpp"
+#include "sflight/mdls/modules/EOMSixDOF.hpp"
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+using namespace sflight;
+
+namespace {
+
+// level flight with a slow roll and pitch, so every term of the rigid body
+// equations is exercised
+const char* const configuration{R"(
+<SimpleFlight>
+   <InitialConditions>
+      <Position Latitude="37.61354309" Longitude="-122.3572449" Altitude="10000"/>
+      <Orientation Heading="270.0" Pitch="2.0" Roll="10.0"/>
+      <Airspeed>250</Airspeed>
+      <Weight>140000</Weight>
+   </InitialConditions>
+   <Inertia Ixx="600000" Iyy="1700000" Izz="2200000" Ixz="20000"/>
+   <Control>
+      <AutoRudder>true</AutoRudder>
+   </Control>
+</SimpleFlight>
+)"};
+
+void configure(xml::Node* const root, mdls::Player* player)
+{
+   xml_bindings::init_Player(root, player);
+   const double weight{player->mass * mdls::nav::gravEq};
+   player->aeroForce = mdls::Vector3(-0.05 * weight, 0, -weight);
+   player->thrust = mdls::Vector3(0.05 * weight, 0, 0);
+   player->aeroMoment = mdls::Vector3(2000, -5000, 0);
+   player->pqr = mdls::Vector3(0.01, 0.002, 0);
+}
+
+// best time of a few runs of 'steps' updates (nanoseconds per update)
+template <class M>
+double time(M* const module, const std::size_t steps)
+{
+   double best{};
+   for (int run = 0; run < 5; run++) {
+      const auto start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < steps; i++) {
+         module->update(1.0 / 60);
+      }
+      const auto end = std::chrono::steady_clock::now();
+      const double ns{std::chrono::duration<double, std::nano>(end - start).count() / steps};
+      best = run == 0 || ns < best ? ns : best;
+   }
+   return best;
+}
+}
+
+int main(int argc, char** argv)
+{
+   const std::size_t steps{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000};
+   if (steps == 0) {
+      std::cout << "usage: sflight-eom [steps]" << std::endl;
+      return 1;
+   }
+
+   xml::Document document;
+   if (!document.parse(configuration)) {
+      std::cout << "Configuration FAILED parsing!\n";
+      return 1;
+   }
+   xml::Node* const root{document.getRoot()};
+
+   // the configuration printouts are not wanted here
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+   mdls::Player fivePlayer;
+   configure(root, &fivePlayer);
+   auto five = new mdls::EOMFiveDOF(&fivePlayer, 60);
+   xml_bindings::init_EOMFiveDOF(root, five);
+   fivePlayer.addModule(five);
+
+   mdls::Player sixPlayer;
+   configure(root, &sixPlayer);
+   auto six = new mdls::EOMSixDOF(&sixPlayer, 60);
+   xml_bindings::init_EOMSixDOF(root, six);
+   sixPlayer.addModule(six);
+   std::cout.rdbuf(out);
+
+   const double fiveTime{time(five, steps)};
+   const double sixTime{time(six, steps)};
+   const double ratio{sixTime / fiveTime};
+
+   std::cout << std::fixed << std::setprecision(1);
+   std::cout << "EOMFiveDOF : " << fiveTime << " ns/step" << std::endl;
+   std::cout << "EOMSixDOF  : " << sixTime << " ns/step" << std::endl;
+   std::cout << std::setprecision(2) << "ratio      : " << ratio << " (limit 2)" << std::endl;
+   return ratio <= 2 ? 0 : 1;
+}
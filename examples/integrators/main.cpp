@@ -0,0 +1,135 @@
+
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+
+#include "sflight/xml_bindings/init_EOMFiveDOF.hpp"
+#include "sflight/xml_bindings/init_Player.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/EOMFiveDOF.hpp"
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace sflight;
+
+namespace {
+
+// a climbing turn: 30 degrees of bank and 1.3 g of lift, with more thrust than drag
+const char* const configuration{R"(
+<SimpleFlight>
+   <InitialConditions>
+      <Position Latitude="37.61354309" Longitude="-122.3572449" Altitude="10000"/>
+      <Orientation Heading="270.0" Pitch="2.0" Roll="30.0"/>
+      <Airspeed>250</Airspeed>
+      <Weight>140000</Weight>
+   </InitialConditions>
+   <Control>
+      <AutoRudder>true</AutoRudder>
+   </Control>
+</SimpleFlight>
+)"};
+
+class Result
+{
+ public:
+   double lat{};
+   double lon{};
+   double alt{};
+   double seconds{};
+};
+
+Result fly(xml::Node* const root, const mdls::EOMFiveDOF::Integrator integrator,
+           const double tolerance, const double rate, const double duration)
+{
+   mdls::Player player;
+   auto eom = new mdls::EOMFiveDOF(&player, rate);
+
+   // the configuration printouts are not wanted here
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+   xml_bindings::init_Player(root, &player);
+   xml_bindings::init_EOMFiveDOF(root, eom);
+   std::cout.rdbuf(out);
+
+   eom->setIntegrator(integrator);
+   eom->setTolerance(tolerance);
+   player.addModule(eom);
+
+   const double weight{player.mass * mdls::nav::gravEq};
+   player.aeroForce = mdls::Vector3(-0.05 * weight, 0, -1.3 * weight);
+   player.thrust = mdls::Vector3(0.08 * weight, 0, 0);
+
+   const std::size_t frames{static_cast<std::size_t>(std::round(duration * rate))};
+   const auto start = std::chrono::steady_clock::now();
+   for (std::size_t i = 0; i < frames; i++) {
+      player.update(1.0 / rate);
+   }
+   const auto end = std::chrono::steady_clock::now();
+
+   Result x;
+   x.lat = player.lat;
+   x.lon = player.lon;
+   x.alt = player.alt;
+   x.seconds = std::chrono::duration<double>(end - start).count();
+   return x;
+}
+
+// distance between the end points of two runs (meters)
+double error(const Result& a, const Result& b)
+{
+   const double north{(a.lat - b.lat) * mdls::nav::radiusEq};
+   const double east{(a.lon - b.lon) * mdls::nav::radiusEq * std::cos(a.lat)};
+   const double down{a.alt - b.alt};
+   return std::sqrt(north * north + east * east + down * down);
+}
+}
+
+int main(int argc, char** argv)
+{
+   const double duration{argc > 1 ? std::atof(argv[1]) : 120.0};
+   const double tolerance{argc > 2 ? std::atof(argv[2]) : 1e-3};
+   if (duration <= 0 || tolerance <= 0) {
+      std::cout << "usage: sflight-integrators [seconds] [adaptive tolerance]" << std::endl;
+      return 1;
+   }
+
+   xml::Document document;
+   if (!document.parse(configuration)) {
+      std::cout << "Configuration FAILED parsing!\n";
+      return 1;
+   }
+   xml::Node* const root{document.getRoot()};
+
+   using Integrator = mdls::EOMFiveDOF::Integrator;
+   const Integrator integrators[]{Integrator::EULER, Integrator::RK2, Integrator::RK4,
+                                  Integrator::ADAMS_BASHFORTH, Integrator::ADAPTIVE};
+   const char* const names[]{"EULER", "RK2", "RK4", "ADAMS_BASHFORTH", "ADAPTIVE"};
+   const double rates[]{100, 60, 30, 20, 10, 5, 2, 1};
+
+   // the trajectory all runs are measured against
+   const Result reference{fly(root, Integrator::RK4, tolerance, 1000, duration)};
+
+   std::cout << duration << " s climbing turn, end point error against RK4 at 1000 Hz"
+             << std::endl << std::endl;
+   std::cout << std::left << std::setw(18) << "integrator" << std::right << std::setw(8)
+             << "rate(Hz)" << std::setw(10) << "frames" << std::setw(14) << "error(m)"
+             << std::setw(12) << "time(ms)" << std::endl;
+
+   for (std::size_t i = 0; i < sizeof(integrators) / sizeof(integrators[0]); i++) {
+      for (const double rate : rates) {
+         const Result x{fly(root, integrators[i], tolerance, rate, duration)};
+         std::cout << std::left << std::setw(18) << names[i] << std::right << std::setw(8)
+                   << rate << std::setw(10) << std::llround(duration * rate)
+                   << std::setw(14) << std::setprecision(4) << std::scientific
+                   << error(x, reference) << std::setw(12) << std::fixed
+                   << std::setprecision(3) << x.seconds * 1000 << std::defaultfloat
+                   << std::endl;
+      }
+   }
+   return 0;
+}
@@ -4,11 +4,14 @@
 #include "sflight/xml/Node.hpp"
 #include "sflight/xml/node_utils.hpp"
 
+#include "sflight/mdls/InputLog.hpp"
 #include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/Profiler.hpp"
 
+#include <chrono>
 #include <iostream>
+#include <ostream>
 #include <thread>
-#include <chrono>
 
 SimExec::SimExec(sflight::mdls::Player* p, const double frameRate)
     : player(p), frameRate(frameRate)
@@ -20,19 +23,70 @@ SimExec::SimExec(sflight::mdls::Player* p, const double frameRate,  const std::s
 {
 }
 
+SimExec::SimExec(const std::vector<sflight::mdls::Player*>& p, const double frameRate,
+                 const std::size_t maxFrames, const std::size_t numThreads,
+                 const bool deterministic)
+    : player(p.empty() ? nullptr : p[0]), frameRate(frameRate), maxFrames(maxFrames),
+      players(p), pool(new ThreadPool(numThreads, deterministic))
+{
+}
+
 void SimExec::start()
 {
    if (player == nullptr || frameRate == 0.0)
       return;
 
+   using Clock = std::chrono::steady_clock;
    const double frameTime{1.0 / frameRate};
-   const long sleepTime{static_cast<long>(frameTime * 1E3)};
+   const Clock::duration spin{
+       std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(spinTime))};
+   // frames behind the schedule before it is restarted
+   const std::size_t maxLag{static_cast<std::size_t>(frameRate) + 1};
+
+   player->paused = false;
+   for (std::size_t i = 0; i < players.size(); i++) {
+      players[i]->paused = false;
+   }
+   stats.clear();
+
+   // deadlines are counted from a fixed origin, never from the last wake up,
+   // and each is worked out from its frame number rather than as a multiple of
+   // a frame time rounded to the clock's tick, which would drift
+   Clock::time_point origin{Clock::now()};
+   std::size_t frame{};
+   const auto deadlineOf = [&origin, this](const std::size_t n) {
+      return origin + std::chrono::duration_cast<Clock::duration>(
+                          std::chrono::duration<double>(n / frameRate));
+   };
 
    while (player->frameNum < maxFrames) {
-      if (!player->paused) {
-         player->update(frameTime);
+      const Clock::time_point deadline{deadlineOf(frame)};
+      if (deadline - spin > Clock::now()) {
+         std::this_thread::sleep_until(deadline - spin);
+      }
+      Clock::time_point now{Clock::now()};
+      while (now < deadline) {
+         now = Clock::now();
+      }
+
+      updatePlayers(frameTime);
+      const Clock::time_point end{Clock::now()};
+
+      using std::chrono::nanoseconds;
+      stats.jitter.record(static_cast<std::uint64_t>(
+          std::chrono::duration_cast<nanoseconds>(now - deadline).count()));
+      stats.compute.record(static_cast<std::uint64_t>(
+          std::chrono::duration_cast<nanoseconds>(end - now).count()));
+
+      frame++;
+      if (end > deadlineOf(frame)) {
+         stats.overruns++;
+         if (end > deadlineOf(frame + maxLag)) {
+            stats.resyncs++;
+            origin = end;
+            frame = 0;
+         }
       }
-      std::this_thread::sleep_for(std::chrono::milliseconds(sleepTime));
    }
 }
 
@@ -43,6 +97,9 @@ void SimExec::startConstructive()
 
    const double frameTime{1.0 / frameRate};
    player->paused = false;
+   for (std::size_t i = 0; i < players.size(); i++) {
+      players[i]->paused = false;
+   }
    double frameGroup{};
 
    while (player->frameNum < maxFrames) {
@@ -52,10 +109,72 @@ void SimExec::startConstructive()
          frameGroup = 0;
       }
       frameGroup++;
+      updatePlayers(frameTime);
+   }
+}
+
+bool SimExec::startReplay(sflight::mdls::InputReplay& replay)
+{
+   if (player == nullptr || !replay.isOpen())
+      return false;
+
+   const double frameTime{replay.getFrameTime()};
+   player->paused = false;
+   while (!replay.isDone(*player)) {
+      replay.update(*player, frameTime);
+   }
+   return replay.isGood();
+}
+
+//
+// Advances every player by one frame; with a pool, returns once all of them
+// have been updated
+//
+void SimExec::updatePlayers(const double frameTime)
+{
+   if (!pool) {
       if (!player->paused) {
-         player->update(frameTime);
+         if (recorder != nullptr) {
+            recorder->update(*player, frameTime);
+         } else {
+            player->update(frameTime);
+         }
+      }
+      return;
+   }
+
+   pool->run(players.size(), [this, frameTime](const std::size_t i) {
+      if (!players[i]->paused) {
+         players[i]->update(frameTime);
+      }
+   });
+}
+
+void SimExec::setProfiling(const bool x)
+{
+   if (player != nullptr) {
+      player->setProfiling(x);
+   }
+   for (std::size_t i = 0; i < players.size(); i++) {
+      players[i]->setProfiling(x);
+   }
+}
+
+void SimExec::printProfile(std::ostream& out) const
+{
+   if (players.empty()) {
+      if (player != nullptr && player->getProfiler() != nullptr) {
+         player->getProfiler()->print(out);
+      }
+      return;
+   }
+   sflight::mdls::Profiler total;
+   for (std::size_t i = 0; i < players.size(); i++) {
+      if (players[i]->getProfiler() != nullptr) {
+         total.add(*players[i]->getProfiler());
       }
    }
+   total.print(out);
 }
 
 void SimExec::initialize(sflight::xml::Node* const node)
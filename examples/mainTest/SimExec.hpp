@@ -2,32 +2,104 @@
 #ifndef __SimExec_H__
 #define __SimExec_H__
 
+#include "ThreadPool.hpp"
+
+#include "sflight/mdls/Histogram.hpp"
+
 #include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
 
 namespace sflight {
-namespace mdls { class Player; }
+namespace mdls { class InputRecorder; class InputReplay; class Player; }
 namespace xml { class Node; }
 }
 
+//------------------------------------------------------------------------------
+// Class: FrameStats
+// Description: Timing of the frames of a real-time run, in nanoseconds.
+//              Compute is the time spent updating the players, jitter how late
+//              each frame started after its deadline; an overrun is a frame
+//              still computing when the next one was due.
+//------------------------------------------------------------------------------
+class FrameStats
+{
+public:
+   void clear()                                 { *this = FrameStats(); }
+
+   sflight::mdls::Histogram compute;
+   sflight::mdls::Histogram jitter;
+   std::uint64_t overruns{};
+   // times the schedule fell too far behind and was restarted from the clock
+   std::uint64_t resyncs{};
+};
+
 //------------------------------------------------------------------------------
 // Class: SimExec
+// Description: Runs one player, or a set of players advanced in parallel by a
+//              thread pool.  Players only touch their own state, so a parallel
+//              run produces the same trajectories as a serial one, whatever
+//              the number of threads.
+//
+//              start() runs in real time: frame n starts at the start time
+//              plus n frame times on a steady clock, so compute time and
+//              sleep granularity never accumulate into drift.  The last part
+//              of each wait can be a busy wait, for tighter timing than the
+//              OS sleep gives at the cost of a core.  A late frame runs at
+//              once; a run more than a second behind starts its schedule over.
+//
+//              A single player's inputs can be logged as it runs, and a log
+//              replayed as fast as possible by startReplay().
 //------------------------------------------------------------------------------
 class SimExec
 {
 public:
    SimExec(sflight::mdls::Player*, const double frameRate);
    SimExec(sflight::mdls::Player*, const double frameRate, const std::size_t maxFrames);
+   SimExec(const std::vector<sflight::mdls::Player*>&, const double frameRate,
+           const std::size_t maxFrames, const std::size_t numThreads,
+           const bool deterministic = false);
    virtual ~SimExec() = default;
 
    void start();
    void startConstructive();
+   // runs the player through the inputs of a log, at its frame time, to its end
+   bool startReplay(sflight::mdls::InputReplay&);
    void stop()                                  {}
    void initialize(sflight::xml::Node* const);
 
+   // length of the busy wait before each real-time frame (seconds)
+   void setSpinTime(const double x)             { spinTime = x;    }
+   double getSpinTime() const                   { return spinTime; }
+
+   // timing of the last real-time run
+   const FrameStats& getStats() const           { return stats;    }
+
+   // times the module updates of every player (see Player::setProfiling)
+   void setProfiling(const bool);
+   // per module of the player, or per module class over all the players
+   void printProfile(std::ostream&) const;
+
+   // logs the inputs of the player while it runs (a single player only)
+   void setRecorder(sflight::mdls::InputRecorder* const x) { recorder = x; }
+
 private:
+   void updatePlayers(const double frameTime);
+
    sflight::mdls::Player* player{};
    double frameRate{};
    std::size_t maxFrames{1000000000};
+
+   double spinTime{};
+   FrameStats stats;
+
+   sflight::mdls::InputRecorder* recorder{};
+
+   // players advanced in parallel
+   std::vector<sflight::mdls::Player*> players;
+   std::unique_ptr<ThreadPool> pool;
 };
 
 #endif
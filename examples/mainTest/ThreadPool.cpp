@@ -0,0 +1,131 @@
+
+#include "ThreadPool.hpp"
+
+// chunks queued per thread and frame; more chunks balance better, fewer cost less locking
+static const std::size_t chunksPerThread{8};
+
+ThreadPool::ThreadPool(const std::size_t numThreads, const bool deterministic)
+    : deterministic(deterministic)
+{
+   const std::size_t n{numThreads > 0 ? numThreads : 1};
+   for (std::size_t i = 0; i < n; i++) {
+      queues.emplace_back(new WorkQueue());
+   }
+   // the caller of run() acts as thread 0
+   for (std::size_t i = 1; i < n; i++) {
+      threads.emplace_back(&ThreadPool::workerLoop, this, i);
+   }
+}
+
+ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+   }
+   startFrame.notify_all();
+   for (std::size_t i = 0; i < threads.size(); i++) {
+      threads[i].join();
+   }
+}
+
+void ThreadPool::run(const std::size_t count, const std::function<void(std::size_t)>& task)
+{
+   const std::size_t n{queues.size()};
+
+   // queue the work before waking anyone; no chunk is added once a frame starts
+   if (deterministic) {
+      for (std::size_t i = 0; i < n; i++) {
+         const Range r{count * i / n, count * (i + 1) / n};
+         if (r.begin < r.end) {
+            queues[i]->ranges.push_back(r);
+         }
+      }
+   } else {
+      const std::size_t numChunks{n * chunksPerThread};
+      const std::size_t size{count / numChunks > 0 ? count / numChunks : 1};
+      std::size_t i{};
+      for (std::size_t begin = 0; begin < count; begin += size) {
+         const Range r{begin, begin + size < count ? begin + size : count};
+         queues[i++ % n]->ranges.push_back(r);
+      }
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      this->task = &task;
+      busy = threads.size();
+      frame++;
+   }
+   startFrame.notify_all();
+
+   work(0);
+
+   // frame barrier
+   std::unique_lock<std::mutex> lock(mutex);
+   endFrame.wait(lock, [this] { return busy == 0; });
+   this->task = nullptr;
+}
+
+void ThreadPool::workerLoop(const std::size_t id)
+{
+   std::size_t lastFrame{};
+   while (true) {
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         startFrame.wait(lock, [&] { return stopping || frame != lastFrame; });
+         if (stopping) {
+            return;
+         }
+         lastFrame = frame;
+      }
+
+      work(id);
+
+      bool last{};
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         last = --busy == 0;
+      }
+      if (last) {
+         endFrame.notify_one();
+      }
+   }
+}
+
+void ThreadPool::work(const std::size_t id)
+{
+   Range r;
+   while (pop(id, r) || (!deterministic && steal(id, r))) {
+      for (std::size_t i = r.begin; i < r.end; i++) {
+         (*task)(i);
+      }
+   }
+}
+
+bool ThreadPool::pop(const std::size_t id, Range& r)
+{
+   WorkQueue& q{*queues[id]};
+   std::lock_guard<std::mutex> lock(q.mutex);
+   if (q.ranges.empty()) {
+      return false;
+   }
+   r = q.ranges.back();
+   q.ranges.pop_back();
+   return true;
+}
+
+bool ThreadPool::steal(const std::size_t id, Range& r)
+{
+   const std::size_t n{queues.size()};
+   for (std::size_t k = 1; k < n; k++) {
+      WorkQueue& q{*queues[(id + k) % n]};
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (!q.ranges.empty()) {
+         r = q.ranges.front();
+         q.ranges.pop_front();
+         return true;
+      }
+   }
+   return false;
+}
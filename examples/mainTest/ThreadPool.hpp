@@ -0,0 +1,76 @@
+
+#ifndef __ThreadPool_H__
+#define __ThreadPool_H__
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Class: ThreadPool
+// Description: Fixed set of worker threads that run indexed tasks.  Each call
+//              to run() splits the index range into chunks dealt round-robin
+//              to per-thread queues; a thread works from the back of its own
+//              queue and, once empty, steals from the front of the others.
+//              run() returns only when every task has finished, so it doubles
+//              as a frame barrier.
+//
+//              In deterministic mode each thread gets one contiguous block of
+//              indices and nothing is stolen, so the same index always runs on
+//              the same thread.
+//------------------------------------------------------------------------------
+class ThreadPool
+{
+public:
+   // 'numThreads' includes the thread calling run()
+   ThreadPool(const std::size_t numThreads, const bool deterministic = false);
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+   virtual ~ThreadPool();
+
+   std::size_t getNumThreads() const            { return queues.size();  }
+   bool isDeterministic() const                 { return deterministic;  }
+
+   // calls task(i) for every i in [0, count)
+   void run(const std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+   class Range
+   {
+   public:
+      std::size_t begin{};
+      std::size_t end{};
+   };
+
+   class WorkQueue
+   {
+   public:
+      std::mutex mutex;
+      std::deque<Range> ranges;
+   };
+
+   void workerLoop(const std::size_t id);
+   void work(const std::size_t id);
+   bool pop(const std::size_t id, Range&);
+   bool steal(const std::size_t id, Range&);
+
+   std::vector<std::unique_ptr<WorkQueue>> queues;
+   std::vector<std::thread> threads;
+   bool deterministic{};
+
+   // frame hand-off between run() and the workers
+   std::mutex mutex;
+   std::condition_variable startFrame;
+   std::condition_variable endFrame;
+   std::size_t frame{};
+   std::size_t busy{};
+   bool stopping{};
+   const std::function<void(std::size_t)>* task{};
+};
+
+#endif
@@ -1,22 +1,52 @@
 
+#include "sflight/xml/Document.hpp"
 #include "sflight/xml/Node.hpp"
-#include "sflight/xml/parser_utils.hpp"
 
 #include "SimExec.hpp"
 
+#include "sflight/image/Image.hpp"
+#include "sflight/image/builder.hpp"
+#include "sflight/image/fingerprint.hpp"
+#include "sflight/mdls/Histogram.hpp"
+#include "sflight/mdls/InputLog.hpp"
 #include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
 #include "sflight/xml_bindings/builder.hpp"
 
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace sflight;
 
+// builds a player from the xml tree, or from the image if there is none
+mdls::Player* createPlayer(xml::Node* node, const image::Image& modelImage)
+{
+   auto player{new mdls::Player()};
+   if (node) {
+      xml_bindings::builder(node, player);
+   } else if (!image::builder(modelImage, player)) {
+      std::exit(1);
+   }
+   return player;
+}
+
+// summary of a frame timing histogram (nanoseconds), in microseconds
+void printTimes(const char* const label, const mdls::Histogram& x)
+{
+   std::cout << label << "mean " << x.getMean() / 1000 << ", p50 "
+             << x.getPercentile(0.5) / 1000.0 << ", p99 " << x.getPercentile(0.99) / 1000.0
+             << ", max " << x.getMax() / 1000.0 << std::endl;
+}
+
 int main(int argc, char** argv)
 {
    if (argc < 4) {
       std::cout << "usage: SimpleFlight <input file> <total time (sec)> <frame "
-                   "rate (frames/sec)>"
+                   "rate (frames/sec)> [num players] [num threads] [deterministic (0/1)] "
+                   "[real time (0/1)] [spin time (ms)] [profile (0/1)] [record|replay <input log>]"
                 << std::endl;
       return 1;
    }
@@ -24,32 +54,125 @@ int main(int argc, char** argv)
    const double total_time{std::atof(argv[2])}; // sec
    const double frame_rate{std::atof(argv[3])}; // hz
    const std::size_t num_frames{static_cast<std::size_t>(total_time * frame_rate)};
+   const std::size_t num_players{argc > 4 ? static_cast<std::size_t>(std::atoi(argv[4])) : 1};
+   const std::size_t num_threads{argc > 5 ? static_cast<std::size_t>(std::atoi(argv[5]))
+                                          : std::thread::hardware_concurrency()};
+   const bool deterministic{argc > 6 && std::atoi(argv[6]) != 0};
+   const bool real_time{argc > 7 && std::atoi(argv[7]) != 0};
+   const double spin_time{argc > 8 ? std::atof(argv[8]) / 1000 : 0}; // sec
+   const bool profile{argc > 9 && std::atoi(argv[9]) != 0};
+   // log the inputs of a single player, or run one through a log as fast as possible
+   const std::string input_mode{argc > 11 ? argv[10] : ""};
+   const std::string input_log{argc > 11 ? argv[11] : ""};
+   if (!input_mode.empty() && input_mode != "record" && input_mode != "replay") {
+      std::cout << "Unknown input log mode : " << input_mode << std::endl;
+      return 1;
+   }
 
    std::cout << "Filename      : " << filename   << std::endl;
    std::cout << "Total time    : " << total_time << std::endl;
    std::cout << "Frame rate    : " << frame_rate << std::endl;
    std::cout << "Num of frames : " << num_frames << std::endl;
 
-   // parse input file and return top node
-   xml::Node* node{xml::parse(filename)};
-   if (node) {
-      std::cout << "Configuration file parsed\n";
-      //std::cout << node->toString() << std::endl;
+   // either a compiled model image or an xml file
+   image::Image modelImage;
+   xml::Document document;
+   xml::Node* node{};
+   if (image::Image::isImage(filename)) {
+      if (!modelImage.open(filename)) {
+         std::exit(1);
+      }
    } else {
-      std::cout << "Configuration file FAILED parsing!\n";
-      std::exit(1);
+      // parse input file and return top node
+      if (document.load(filename)) {
+         node = document.getRoot();
+         std::cout << "Configuration file parsed\n";
+         //std::cout << node->toString() << std::endl;
+      } else {
+         std::cout << "Configuration file FAILED parsing!\n";
+         std::exit(1);
+      }
    }
 
-   std::cout << "Creating and configuring a new player" << std::endl;
-   auto player{new mdls::Player()};
-   xml_bindings::builder(node, player);
+   SimExec* exec{};
+   mdls::Player* single{};
+   std::vector<mdls::Player*> players;
+   if (num_players > 1) {
+      std::cout << "Creating and configuring " << num_players << " players" << std::endl;
 
-   std::cout << "Creating new simulation executive" << std::endl;
-   auto exec{new SimExec(player, frame_rate, num_frames)};
-   std::cout << "Running for " << total_time << " seconds." << std::endl;
-   exec->startConstructive();
+      for (std::size_t i = 0; i < num_players; i++) {
+         auto player{createPlayer(node, modelImage)};
+
+         // each player writes its own output file: <path>.<index>
+         for (std::size_t j = 0; j < player->modules.size(); j++) {
+            auto fileOutput{dynamic_cast<mdls::FileOutput*>(player->modules[j])};
+            if (fileOutput && !fileOutput->getFilename().empty()) {
+               fileOutput->setFilename(fileOutput->getFilename() + "." + std::to_string(i));
+            }
+         }
+         players.push_back(player);
+      }
+
+      std::cout << "Creating new simulation executive with " << num_threads << " threads"
+                << (deterministic ? " (deterministic)" : "") << std::endl;
+      exec = new SimExec(players, frame_rate, num_frames, num_threads, deterministic);
+   } else {
+      std::cout << "Creating and configuring a new player" << std::endl;
+      single = createPlayer(node, modelImage);
+
+      std::cout << "Creating new simulation executive" << std::endl;
+      exec = new SimExec(single, frame_rate, num_frames);
+   }
+   exec->setProfiling(profile);
+
+   mdls::InputRecorder recorder;
+   if (input_mode == "record") {
+      if (single == nullptr ||
+          !recorder.open(input_log, *single, 1.0 / frame_rate, image::fingerprint(*single))) {
+         std::cout << "Could not record the inputs of the player" << std::endl;
+         return 1;
+      }
+      exec->setRecorder(&recorder);
+   }
+
+   if (input_mode == "replay") {
+      mdls::InputReplay replay;
+      std::cout << "Replaying " << input_log << std::endl;
+      if (single == nullptr || !replay.open(input_log, *single, image::fingerprint(*single)) ||
+          !exec->startReplay(replay)) {
+         std::cout << "Replay FAILED" << std::endl;
+         return 1;
+      }
+   } else if (real_time) {
+      std::cout << "Running for " << total_time << " seconds." << std::endl;
+      exec->setSpinTime(spin_time);
+      exec->start();
+   } else {
+      std::cout << "Running for " << total_time << " seconds." << std::endl;
+      exec->startConstructive();
+   }
+   recorder.close();
    std::cout << "Simulation finished" << std::endl;
 
+   if (real_time && input_mode != "replay") {
+      const FrameStats& stats{exec->getStats()};
+      printTimes("Compute (us)  : ", stats.compute);
+      printTimes("Jitter (us)   : ", stats.jitter);
+      std::cout << "Overruns      : " << stats.overruns << " (" << stats.resyncs
+                << " resyncs)" << std::endl;
+   }
+   if (profile) {
+      std::cout << std::endl;
+      exec->printProfile(std::cout);
+   }
+
+   // closes the output files
+   delete exec;
+   delete single;
+   for (std::size_t i = 0; i < players.size(); i++) {
+      delete players[i];
+   }
+
    std::cout << std::flush;
    return 0;
 }
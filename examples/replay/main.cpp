@@ -0,0 +1,185 @@
+#include "sflight/xml/Document.hpp"
+#include "sflight/xml/Node.hpp"
+
+#include "sflight/image/Image.hpp"
+#include "sflight/image/Snapshot.hpp"
+#include "sflight/image/builder.hpp"
+#include "sflight/image/fingerprint.hpp"
+#include "sflight/mdls/InputLog.hpp"
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/UnitConvert.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
+#include "sflight/xml_bindings/builder.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+//
+// Records the inputs a script gives a player, replays the log into a second
+// player built from the same model and checks that it ends in exactly the
+// same state; then checks that a player in another state is refused
+//
+
+using namespace sflight;
+
+namespace {
+
+// a player built from the xml model or the image, with no file output
+std::unique_ptr<mdls::Player> createPlayer(xml::Node* node, const image::Image& modelImage)
+{
+   std::unique_ptr<mdls::Player> player{new mdls::Player()};
+   if (node) {
+      xml_bindings::builder(node, player.get());
+   } else if (!image::builder(modelImage, player.get())) {
+      return nullptr;
+   }
+   for (std::size_t i = 0; i < player->modules.size(); i++) {
+      if (auto fileOutput = dynamic_cast<mdls::FileOutput*>(player->modules[i])) {
+         fileOutput->setFilename("");
+      }
+   }
+   return player;
+}
+
+// every half second, one of the commands a pilot or an outside program would
+// give: round headings, altitudes and speeds, a throttle setting anywhere in
+// its range, or a hold switched on or off
+class Script
+{
+ public:
+   std::size_t changes{};
+
+   void update(mdls::Player& player, const double frameRate)
+   {
+      const std::uint64_t period{static_cast<std::uint64_t>(frameRate / 2)};
+      if (period != 0 && player.frameNum % period != 0) {
+         return;
+      }
+      mdls::AutoPilotCmds& cmds{player.autoPilotCmds};
+      switch (generator() % 6) {
+         case 0:
+            cmds.setCmdHeading(mdls::UnitConvert::toRads(generator() % 360));
+            break;
+         case 1:
+            cmds.setCmdAltitude(mdls::UnitConvert::toMeters(5000 + 500 * (generator() % 31)));
+            break;
+         case 2:
+            cmds.setCmdSpeed(mdls::UnitConvert::toMPS(250 + 10 * (generator() % 16)));
+            break;
+         case 3:
+            player.throttle = std::uniform_real_distribution<double>(0.2, 1.0)(generator);
+            break;
+         case 4:
+            cmds.setAltHoldOn(!cmds.isAltHoldOn());
+            break;
+         default:
+            cmds.setHdgHoldOn(!cmds.isHdgHoldOn());
+            break;
+      }
+      changes++;
+   }
+
+ private:
+   std::mt19937_64 generator{1};
+};
+}
+
+int main(int argc, char** argv)
+{
+   if (argc < 2) {
+      std::cout << "usage: sflight-replay <model file> [total time (sec)] [frame rate "
+                   "(frames/sec)] [input log]"
+                << std::endl;
+      return 1;
+   }
+   const std::string filename{argv[1]};
+   const double totalTime{argc > 2 ? std::atof(argv[2]) : 600};
+   const double frameRate{argc > 3 ? std::atof(argv[3]) : 60};
+   const std::string logFile{argc > 4 ? argv[4] : "inputs.log"};
+   if (totalTime <= 0 || frameRate <= 0) {
+      std::cout << "The time and frame rate must be positive" << std::endl;
+      return 1;
+   }
+   const std::uint64_t numFrames{static_cast<std::uint64_t>(totalTime * frameRate)};
+
+   image::Image modelImage;
+   xml::Document document;
+   xml::Node* node{};
+   if (image::Image::isImage(filename)) {
+      if (!modelImage.open(filename)) {
+         return 1;
+      }
+   } else if (document.load(filename)) {
+      node = document.getRoot();
+   } else {
+      std::cout << "Configuration FAILED parsing!\n";
+      return 1;
+   }
+
+   // the configuration printouts are not wanted here
+   std::streambuf* const out{std::cout.rdbuf(nullptr)};
+   std::unique_ptr<mdls::Player> recorded{createPlayer(node, modelImage)};
+   std::unique_ptr<mdls::Player> replayed{createPlayer(node, modelImage)};
+   std::unique_ptr<mdls::Player> other{createPlayer(node, modelImage)};
+   std::cout.rdbuf(out);
+   std::cout.clear();
+   if (!recorded || !replayed || !other) {
+      return 1;
+   }
+
+   // record
+   mdls::InputRecorder recorder;
+   if (!recorder.open(logFile, *recorded, 1 / frameRate, image::fingerprint(*recorded))) {
+      return 1;
+   }
+   Script script;
+   recorded->paused = false;
+   while (recorded->frameNum < numFrames) {
+      script.update(*recorded, frameRate);
+      recorder.update(*recorded, 1 / frameRate);
+   }
+   recorder.close();
+
+   long logSize{};
+   if (std::FILE* const file = std::fopen(logFile.c_str(), "rb")) {
+      std::fseek(file, 0, SEEK_END);
+      logSize = std::ftell(file) - static_cast<long>(sizeof(mdls::InputLogHeader));
+      std::fclose(file);
+   }
+   std::cout << "Recorded " << numFrames << " frames with " << script.changes
+             << " scripted input changes to " << logFile << " (" << logSize << " bytes, "
+             << static_cast<double>(logSize) / script.changes << " per change)" << std::endl;
+
+   // replay into a second player, which has to end in the same state
+   mdls::InputReplay replay;
+   if (!replay.open(logFile, *replayed, image::fingerprint(*replayed))) {
+      std::cout << "Replay FAILED" << std::endl;
+      return 1;
+   }
+   replayed->paused = false;
+   while (!replay.isDone(*replayed)) {
+      replay.update(*replayed, replay.getFrameTime());
+   }
+   image::Snapshot expected;
+   image::Snapshot actual;
+   expected.save(*recorded);
+   actual.save(*replayed);
+   const bool same{replay.isGood() && expected.getSize() == actual.getSize() &&
+                   std::memcmp(expected.getData(), actual.getData(), actual.getSize()) == 0};
+   std::cout << "Replay " << (same ? "matches" : "DIFFERS FROM") << " the recording on frame "
+             << replayed->frameNum << std::endl;
+
+   // a player that does not start where the recording did is refused
+   other->alt += 1;
+   mdls::InputReplay refused;
+   const bool accepted{refused.open(logFile, *other, image::fingerprint(*other))};
+   std::cout << "Replay into a player 1 m higher "
+             << (accepted ? "was ACCEPTED" : "was refused") << std::endl;
+
+   return same && !accepted ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+
+#include "sflight/mdls/GridTable.hpp"
+#include "sflight/mdls/Table2D.hpp"
+#include "sflight/mdls/Table3D.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace sflight;
+
+namespace {
+
+//
+// The interpolation of Table2D and Table3D as it was before TableAxis: the
+// interval is found by a linear scan from the first breakpoint
+//
+void scan(const double vals[], const std::size_t n, const double x, std::size_t& low,
+          std::size_t& high, double& weight)
+{
+   low = 0;
+   high = 0;
+   weight = 0;
+   for (std::size_t i = 1; i < n; i++) {
+      low = i - 1;
+      high = i;
+      if (vals[i] > x) {
+         break;
+      }
+   }
+   if (n > 1) {
+      weight = (x - vals[low]) / (vals[high] - vals[low]);
+   }
+}
+
+double scan2D(const std::vector<double>& rows, const std::vector<double>& cols,
+              const std::vector<double>& data, const double row, const double col)
+{
+   std::size_t lowrow{}, highrow{}, lowcol{}, highcol{};
+   double rowweight{}, colweight{};
+   scan(rows.data(), rows.size(), row, lowrow, highrow, rowweight);
+   scan(cols.data(), cols.size(), col, lowcol, highcol, colweight);
+
+   const std::size_t n{cols.size()};
+   const double* const low{&data[lowrow * n]};
+   const double* const high{&data[highrow * n]};
+   const double firstRow{low[lowcol] + (low[highcol] - low[lowcol]) * colweight};
+   const double secRow{high[lowcol] + (high[highcol] - high[lowcol]) * colweight};
+   return firstRow + (secRow - firstRow) * rowweight;
+}
+
+//------------------------------------------------------------------------------
+// Class: Grid
+// Description: A random 3-D table: breakpoints of each axis and values in
+//              row-major order
+//------------------------------------------------------------------------------
+class Grid
+{
+ public:
+   std::vector<std::vector<double>> axes;
+   std::vector<double> values;
+
+   std::size_t pageSize() const                 { return axes[1].size() * axes[2].size(); }
+
+   double scan(const double x[]) const
+   {
+      std::size_t low{}, high{};
+      double weight{};
+      ::scan(axes[0].data(), axes[0].size(), x[0], low, high, weight);
+      const std::vector<double> first(values.begin() + low * pageSize(),
+                                      values.begin() + (low + 1) * pageSize());
+      const std::vector<double> second(values.begin() + high * pageSize(),
+                                       values.begin() + (high + 1) * pageSize());
+      const double a{scan2D(axes[1], axes[2], first, x[1], x[2])};
+      const double b{scan2D(axes[1], axes[2], second, x[1], x[2])};
+      return a + (b - a) * weight;
+   }
+};
+
+// evenly spaced, nearly evenly spaced (within the tolerance TableAxis allows)
+// or irregular breakpoints
+std::vector<double> makeAxis(std::mt19937_64& rng, const std::size_t n)
+{
+   std::uniform_real_distribution<double> uniform(0, 1);
+   const double first{-100 + 200 * uniform(rng)};
+   const double step{0.01 + 10 * uniform(rng)};
+   const int kind{static_cast<int>(rng() % 3)};
+   std::vector<double> x(n);
+   for (std::size_t i = 0; i < n; i++) {
+      x[i] = first + static_cast<double>(i) * step;
+      if (kind == 1 && i > 0 && i + 1 < n) {
+         x[i] += (uniform(rng) - 0.5) * 1e-6 * step;
+      } else if (kind == 2 && i > 0) {
+         x[i] = x[i - 1] + step * (0.05 + 2 * uniform(rng));
+      }
+   }
+   return x;
+}
+
+Grid makeGrid(std::mt19937_64& rng)
+{
+   std::uniform_real_distribution<double> uniform(-5, 5);
+   Grid grid;
+   for (int axis = 0; axis < 3; axis++) {
+      grid.axes.push_back(makeAxis(rng, 1 + rng() % 25));
+   }
+   grid.values.resize(grid.axes[0].size() * grid.pageSize());
+   for (std::size_t i = 0; i < grid.values.size(); i++) {
+      grid.values[i] = uniform(rng);
+   }
+   return grid;
+}
+
+// a query on one axis: inside, on a breakpoint, outside, or near the last one
+double makeQuery(std::mt19937_64& rng, const std::vector<double>& axis, const double last)
+{
+   std::uniform_real_distribution<double> uniform(0, 1);
+   const double low{axis.front()};
+   const double span{axis.back() - axis.front() + 1};
+   switch (rng() % 4) {
+   case 0:
+      return axis[rng() % axis.size()];
+   case 1:
+      return low - span + 3 * span * uniform(rng);
+   case 2:
+      return last + (uniform(rng) - 0.5) * 0.1 * span / static_cast<double>(axis.size());
+   default:
+      return low + (span - 1) * uniform(rng);
+   }
+}
+
+bool same(const double a, const double b) { return std::memcmp(&a, &b, sizeof(a)) == 0; }
+
+// Table3D (TableAxis) and GridTable in both layouts against the linear scan
+bool check(const std::size_t numGrids, const std::size_t queriesPerGrid, const unsigned seed)
+{
+   std::mt19937_64 rng(seed);
+   std::size_t queries{};
+   std::size_t table3DErrors{};
+   std::size_t gridErrors{};
+
+   for (std::size_t g = 0; g < numGrids; g++) {
+      const Grid grid{makeGrid(rng)};
+      const std::vector<double>& pages{grid.axes[0]};
+      const std::vector<double>& rows{grid.axes[1]};
+      const std::vector<double>& cols{grid.axes[2]};
+
+      // tables own their breakpoint arrays, and Table3D does not own its pages
+      double* const pageVals{new double[pages.size()]};
+      std::copy(pages.begin(), pages.end(), pageVals);
+      mdls::Table3D table3D(pages.size(), pageVals);
+      std::vector<mdls::Table2D*> tables;
+      for (std::size_t p = 0; p < pages.size(); p++) {
+         double* const rowVals{new double[rows.size()]};
+         double* const colVals{new double[cols.size()]};
+         std::copy(rows.begin(), rows.end(), rowVals);
+         std::copy(cols.begin(), cols.end(), colVals);
+         tables.push_back(new mdls::Table2D(rows.size(), cols.size(), rowVals, colVals));
+         for (std::size_t i = 0; i < rows.size(); i++) {
+            for (std::size_t j = 0; j < cols.size(); j++) {
+               tables[p]->set(i, j, grid.values[p * grid.pageSize() + i * cols.size() + j]);
+            }
+         }
+         table3D.setPage(p, tables[p]);
+      }
+      mdls::GridTable cell(grid.axes, mdls::GridTable::Layout::CELL);
+      mdls::GridTable rowMajor(grid.axes, mdls::GridTable::Layout::ROW_MAJOR);
+      cell.setData(grid.values);
+      rowMajor.setData(grid.values);
+
+      double x[3]{};
+      for (std::size_t q = 0; q < queriesPerGrid; q++, queries++) {
+         for (int axis = 0; axis < 3; axis++) {
+            x[axis] = makeQuery(rng, grid.axes[axis], x[axis]);
+         }
+         const double expected{grid.scan(x)};
+         if (!same(table3D.interp(x[0], x[1], x[2]), expected)) {
+            table3DErrors++;
+         }
+         if (!same(cell.interp(x), expected) || !same(rowMajor.interp(x), expected)) {
+            gridErrors++;
+         }
+      }
+      for (std::size_t p = 0; p < tables.size(); p++) {
+         delete tables[p];
+      }
+   }
+
+   std::cout << "Queries           : " << queries << " on " << numGrids << " tables"
+             << std::endl;
+   std::cout << "Table3D differs   : " << table3DErrors << std::endl;
+   std::cout << "GridTable differs : " << gridErrors << std::endl;
+   return table3DErrors == 0 && gridErrors == 0;
+}
+}
+
+//
+// Checks that Table2D/Table3D (with TableAxis) and GridTable interpolate bit for
+// bit like the linear breakpoint scan they replaced
+//
+int main(int argc, char** argv)
+{
+   std::size_t tables{2000};
+   std::size_t queries{500};
+   unsigned seed{1};
+   for (int i = 1; i < argc; i++) {
+      const std::string arg{argv[i]};
+      const bool more{i + 1 < argc};
+      if (arg == "--tables" && more) {
+         tables = static_cast<std::size_t>(std::atol(argv[++i]));
+      } else if (arg == "--queries" && more) {
+         queries = static_cast<std::size_t>(std::atol(argv[++i]));
+      } else if (arg == "--seed" && more) {
+         seed = static_cast<unsigned>(std::atol(argv[++i]));
+      } else {
+         std::cout << "usage: sflight-tables [--tables <count>] [--queries <per table>] "
+                      "[--seed <seed>]"
+                   << std::endl;
+         return 1;
+      }
+   }
+   return check(tables, queries, seed) ? 0 : 1;
+}
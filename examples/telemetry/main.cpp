@@ -0,0 +1,16 @@
+
+#include "sflight/mdls/Telemetry.hpp"
+
+#include <iostream>
+#include <string>
+
+using namespace sflight;
+
+int main(int argc, char** argv)
+{
+   if (argc < 3) {
+      std::cout << "usage: sflight-telemetry <telemetry log> <output text file>" << std::endl;
+      return 1;
+   }
+   return mdls::convertTelemetry(argv[1], argv[2]) ? 0 : 1;
+}
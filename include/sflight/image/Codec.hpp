@@ -0,0 +1,92 @@
+
+#ifndef __sflight_image_Codec_HPP__
+#define __sflight_image_Codec_HPP__
+
+#include "sflight/image/format.hpp"
+
+namespace sflight {
+namespace mdls {
+class Player;
+class Module;
+class AutoPilotCmds;
+class Inertia;
+class Quaternion;
+class Vector3;
+class AutoPilot;
+class Atmosphere;
+class EOMFiveDOF;
+class EOMSixDOF;
+class Engine;
+class FileOutput;
+class InterpAero;
+class InverseDesign;
+class StickControl;
+class TableAero;
+class WaypointFollower;
+}
+namespace image {
+class Reader;
+class Writer;
+
+//------------------------------------------------------------------------------
+// Class: Codec
+// Description: Moves the state of a player and of its modules to and from an
+//              image.  Each class has one list of fields, used by both Writer
+//              and Reader, so the two directions cannot disagree.
+//------------------------------------------------------------------------------
+class Codec
+{
+ public:
+   static void save(Writer&, mdls::Player&);
+   static void load(Reader&, mdls::Player&);
+
+   // writes the state of a module and returns its type, NONE if it has no
+   // image form (nothing is written then)
+   static ModuleType save(Writer&, mdls::Module*);
+
+   // creates a module of the given type for 'player' from its state; returns
+   // null for an unknown type or a block that does not hold the module
+   static mdls::Module* load(Reader&, const ModuleType, mdls::Player*);
+
+   // the state that changes as a player runs, its own and its modules', but
+   // none of their configuration; loading it fails unless the player has the
+   // same types of module, in the same order, as the one it was saved from
+   static void saveState(Writer&, mdls::Player&);
+   static void loadState(Reader&, mdls::Player&);
+
+   // the image type of a module, NONE if it has no image form
+   static ModuleType getType(mdls::Module*);
+
+ private:
+   template <class T> static mdls::Module* create(Reader&, mdls::Player*);
+
+   template <class Archive> static void fields(Archive&, mdls::Player&);
+   template <class Archive> static void fields(Archive&, mdls::Module&);
+   template <class Archive> static void fields(Archive&, mdls::AutoPilotCmds&);
+   template <class Archive> static void fields(Archive&, mdls::Inertia&);
+   template <class Archive> static void fields(Archive&, mdls::Quaternion&);
+   template <class Archive> static void fields(Archive&, mdls::Vector3&);
+   template <class Archive> static void fields(Archive&, mdls::AutoPilot&);
+   template <class Archive> static void fields(Archive&, mdls::Atmosphere&);
+   template <class Archive> static void fields(Archive&, mdls::EOMFiveDOF&);
+   template <class Archive> static void fields(Archive&, mdls::EOMSixDOF&);
+   template <class Archive> static void fields(Archive&, mdls::Engine&);
+   template <class Archive> static void fields(Archive&, mdls::FileOutput&);
+   template <class Archive> static void fields(Archive&, mdls::InterpAero&);
+   template <class Archive> static void fields(Archive&, mdls::InverseDesign&);
+   template <class Archive> static void fields(Archive&, mdls::StickControl&);
+   template <class Archive> static void fields(Archive&, mdls::TableAero&);
+   template <class Archive> static void fields(Archive&, mdls::WaypointFollower&);
+
+   template <class Archive> static void state(Archive&, mdls::Player&);
+   template <class Archive> static void state(Archive&, mdls::Module*, const ModuleType);
+   template <class Archive> static void state(Archive&, mdls::AutoPilot&);
+   template <class Archive> static void state(Archive&, mdls::EOMFiveDOF&);
+   template <class Archive> static void state(Archive&, mdls::Engine&);
+   template <class Archive> static void state(Archive&, mdls::FileOutput&);
+   template <class Archive> static void state(Archive&, mdls::WaypointFollower&);
+};
+}
+}
+
+#endif
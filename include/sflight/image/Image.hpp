@@ -0,0 +1,56 @@
+
+#ifndef __sflight_image_Image_HPP__
+#define __sflight_image_Image_HPP__
+
+#include "sflight/image/format.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sflight {
+namespace image {
+
+//------------------------------------------------------------------------------
+// Class: Image
+// Description: A compiled model image, mapped into memory.  Players built from
+//              the image point their tables straight into it, so it must stay
+//              open as long as they exist, and players of the same type share
+//              the same pages.  The image is never written: a table changed
+//              after loading (scaled, say) first copies its values, so other
+//              players built from the image, and the file, are unaffected.
+//------------------------------------------------------------------------------
+class Image
+{
+ public:
+   Image() = default;
+   Image(const Image&) = delete;
+   Image& operator=(const Image&) = delete;
+   ~Image();
+
+   // maps the file and checks its header; false if it is not a valid image
+   bool open(const std::string& filename);
+   void close();
+
+   bool isOpen() const                                       { return data != nullptr; }
+   char* getData() const                                     { return data;            }
+   std::size_t getSize() const                               { return size;            }
+   const Header& getHeader() const                           { return header;          }
+
+   // true if the file starts like an image
+   static bool isImage(const std::string& filename);
+
+ private:
+   bool check();
+
+   char* data{};
+   std::size_t size{};
+   Header header;
+
+   // where memory mapping is not available the file is read into this buffer
+   std::unique_ptr<double[]> buffer;
+};
+}
+}
+
+#endif
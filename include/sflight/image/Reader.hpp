@@ -0,0 +1,136 @@
+
+#ifndef __sflight_image_Reader_HPP__
+#define __sflight_image_Reader_HPP__
+
+#include "sflight/image/format.hpp"
+
+#include "sflight/mdls/GridTable.hpp"
+#include "sflight/mdls/TableND.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sflight {
+namespace image {
+
+//------------------------------------------------------------------------------
+// Class: Reader
+// Description: Reads the values of one block of an image in the order Writer
+//              wrote them.  Reads past the end of the block, or tables that do
+//              not fit in it, fail: the value is left unchanged and isGood()
+//              returns false from then on.
+//
+//              Tables are not copied; they point into the image, which must
+//              outlive them.
+//------------------------------------------------------------------------------
+class Reader
+{
+ public:
+   Reader() = delete;
+   // the block of 'size' bytes at 'offset' in the image at 'data'
+   Reader(char* data, const std::uint64_t offset, const std::uint64_t size);
+
+   bool isGood() const                                       { return good;       }
+   bool isEnd() const                                        { return pos == end; }
+
+   // returns the next 'size' bytes, or null if there are not that many
+   char* read(const std::size_t size);
+
+   void io(double& x)                                        { get(&x, sizeof(x)); }
+   void io(bool& x);
+   void io(int& x);
+   void io(std::int64_t& x)                                  { get(&x, sizeof(x)); }
+   void io(std::uint64_t& x)                                 { get(&x, sizeof(x)); }
+   void io(std::string&);
+
+   template <class E, class = typename std::enable_if<std::is_enum<E>::value>::type>
+   void io(E& x)
+   {
+      std::int64_t value{static_cast<std::int64_t>(x)};
+      io(value);
+      x = static_cast<E>(value);
+   }
+
+   template <std::size_t Rank>
+   void io(std::shared_ptr<mdls::TableND<Rank>>& table);
+
+   // fails unless 'x' holds (e.g. a value read matches what was expected)
+   void check(const bool x)                                  { good = good && x;   }
+
+   // sizes the vector for 'n' elements, provided the block can hold that many
+   template <class T>
+   void resize(std::vector<T>& x, const std::uint64_t n)
+   {
+      if (n > (end - pos) / sizeof(double)) {
+         good = false;
+         return;
+      }
+      x.resize(n);
+   }
+
+ private:
+   void get(void* x, const std::size_t size);
+
+   char* data{};
+   std::uint64_t pos{};
+   std::uint64_t end{};
+   bool good{true};
+};
+
+template <std::size_t Rank>
+void Reader::io(std::shared_ptr<mdls::TableND<Rank>>& table)
+{
+   bool present{};
+   io(present);
+   if (!present) {
+      table.reset();
+      return;
+   }
+
+   TableEntry entry;
+   get(&entry, sizeof(entry));
+   good = good && entry.rank == Rank &&
+          entry.layout == static_cast<std::uint32_t>(mdls::GridTable::Layout::CELL);
+   if (!good) {
+      return;
+   }
+
+   // sizes are checked against the block before anything is multiplied out
+   std::vector<std::size_t> numVals(Rank);
+   const std::uint64_t maxVals{(end - pos) / sizeof(double)};
+   std::uint64_t totalVals{};
+   std::uint64_t dataSize{std::uint64_t(1) << Rank};
+   for (std::size_t i = 0; i < Rank && good; i++) {
+      const std::uint64_t cells{entry.numVals[i] > 1 ? entry.numVals[i] - 1 : 1};
+      good = entry.numVals[i] > 0 && entry.numVals[i] <= maxVals && dataSize <= maxVals / cells;
+      numVals[i] = static_cast<std::size_t>(entry.numVals[i]);
+      totalVals += entry.numVals[i];
+      dataSize *= cells;
+   }
+   good = good && dataSize == entry.dataSize;
+
+   // both arrays must lie in what is left of the block, values last
+   good = good && entry.valsOffset == pos && totalVals <= (end - pos) / sizeof(double) &&
+          entry.dataOffset >= pos + totalVals * sizeof(double) && entry.dataOffset % 64 == 0 &&
+          entry.dataOffset <= end && entry.dataSize <= (end - entry.dataOffset) / sizeof(double);
+   if (!good) {
+      return;
+   }
+
+   const double* vals{reinterpret_cast<const double*>(data + entry.valsOffset)};
+   double* values{reinterpret_cast<double*>(data + entry.dataOffset)};
+   table = std::make_shared<mdls::TableND<Rank>>(numVals, vals, values);
+   for (std::size_t i = 0; i < Rank; i++) {
+      table->setClamp(i, (entry.clamp >> i) & 1);
+   }
+   pos = entry.dataOffset + entry.dataSize * sizeof(double);
+}
+}
+}
+
+#endif
@@ -0,0 +1,47 @@
+
+#ifndef __sflight_image_Snapshot_HPP__
+#define __sflight_image_Snapshot_HPP__
+
+#include "sflight/image/Writer.hpp"
+
+#include <cstddef>
+
+namespace sflight {
+namespace mdls { class Player; }
+namespace image {
+
+//------------------------------------------------------------------------------
+// Class: Snapshot
+// Description: The state of a running player and of its modules, in one
+//              contiguous buffer laid out like an image block (see
+//              Codec::saveState).  Configuration and tables are left out, so
+//              a snapshot is a few kilobytes and takes microseconds to take or
+//              restore.
+//
+//              A snapshot restores into the player it was taken from, or into
+//              any player built from the same model, which then runs on
+//              exactly as the original would have.  Branching runs from a
+//              common prefix means copying the snapshot, not simulating the
+//              prefix again.  Output files are not part of the state.
+//------------------------------------------------------------------------------
+class Snapshot
+{
+ public:
+   // replaces the contents with the state of the player; the buffer is reused
+   void save(mdls::Player&);
+
+   // returns false, with the player possibly part restored, if the player's
+   // modules do not match those the snapshot was taken from
+   bool restore(mdls::Player&) const;
+
+   bool isEmpty() const                         { return getSize() == 0;            }
+   std::size_t getSize() const                  { return writer.getBuffer().size(); }
+   const char* getData() const                  { return writer.getBuffer().data(); }
+
+ private:
+   Writer writer;
+};
+}
+}
+
+#endif
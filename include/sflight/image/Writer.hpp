@@ -0,0 +1,107 @@
+
+#ifndef __sflight_image_Writer_HPP__
+#define __sflight_image_Writer_HPP__
+
+#include "sflight/image/format.hpp"
+
+#include "sflight/mdls/TableND.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sflight {
+namespace image {
+
+//------------------------------------------------------------------------------
+// Class: Writer
+// Description: Builds an image in memory.  The io() functions append one value
+//              each, in the form Reader expects; they take the same arguments
+//              as Reader's, so one list of fields serves both directions.
+//------------------------------------------------------------------------------
+class Writer
+{
+ public:
+   const std::vector<char>& getBuffer() const                { return buffer;        }
+   std::uint64_t tell() const                                { return buffer.size(); }
+   bool isGood() const                                       { return true;          }
+
+   // empties the buffer, keeping its memory for the next image
+   void clear()                                              { buffer.clear();       }
+
+   // pads with zeros up to a multiple of 'bytes'
+   void align(const std::size_t bytes);
+
+   void write(const void* data, const std::size_t size);
+
+   // overwrites bytes already written
+   void patch(const std::uint64_t offset, const void* data, const std::size_t size);
+
+   void io(const double x)                                   { write(&x, sizeof(x)); }
+   void io(const bool x)                                     { io(std::uint64_t(x)); }
+   void io(const int x)                                      { io(std::int64_t(x));  }
+   void io(const std::int64_t x)                             { write(&x, sizeof(x)); }
+   void io(const std::uint64_t x)                            { write(&x, sizeof(x)); }
+   void io(const std::string&);
+
+   template <class E, class = typename std::enable_if<std::is_enum<E>::value>::type>
+   void io(const E x)
+   {
+      io(static_cast<std::int64_t>(x));
+   }
+
+   template <std::size_t Rank>
+   void io(const std::shared_ptr<mdls::TableND<Rank>>& table);
+
+   // Reader fails unless 'x' holds; nothing to do here
+   void check(const bool)                                                              {}
+
+   // Reader resizes the vector to 'n' elements; nothing to do here
+   template <class T>
+   void resize(std::vector<T>&, const std::uint64_t)                                  {}
+
+ private:
+   std::vector<char> buffer;
+};
+
+template <std::size_t Rank>
+void Writer::io(const std::shared_ptr<mdls::TableND<Rank>>& table)
+{
+   io(table != nullptr);
+   if (table == nullptr) {
+      return;
+   }
+
+   const mdls::GridTable& grid{table->getGrid()};
+
+   TableEntry entry;
+   entry.rank = static_cast<std::uint32_t>(Rank);
+   entry.layout = static_cast<std::uint32_t>(grid.getLayout());
+   for (std::size_t i = 0; i < Rank; i++) {
+      entry.numVals[i] = grid.getNumVals(i);
+      entry.clamp |= std::uint64_t(table->getClamp(i)) << i;
+   }
+   entry.dataSize = grid.getDataSize();
+
+   const std::uint64_t entryOffset{tell()};
+   write(&entry, sizeof(entry));
+
+   entry.valsOffset = tell();
+   for (std::size_t i = 0; i < Rank; i++) {
+      write(grid.getVals(i), grid.getNumVals(i) * sizeof(double));
+   }
+
+   align(64);
+   entry.dataOffset = tell();
+   write(grid.getData(), grid.getDataSize() * sizeof(double));
+
+   patch(entryOffset, &entry, sizeof(entry));
+}
+}
+}
+
+#endif
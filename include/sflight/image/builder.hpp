@@ -0,0 +1,19 @@
+
+#ifndef __sflight_image_builder_HPP__
+#define __sflight_image_builder_HPP__
+
+namespace sflight {
+
+namespace mdls { class Player; }
+namespace image {
+class Image;
+
+// configures a player, and creates its modules, from an open image; the
+// player's tables point into the image.  Returns false if the image does not
+// hold a valid model.
+bool builder(const Image&, mdls::Player*);
+}
+
+}
+
+#endif
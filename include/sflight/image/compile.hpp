@@ -0,0 +1,20 @@
+
+#ifndef __sflight_image_compile_HPP__
+#define __sflight_image_compile_HPP__
+
+#include <string>
+
+namespace sflight {
+
+namespace xml  { class Node; }
+namespace image {
+
+// configures a prototype player from the node (as xml_bindings::builder does)
+// and writes it, with its modules and tables, to an image file.  Returns false
+// if the file could not be written.
+bool compile(xml::Node*, const std::string& filename);
+}
+
+}
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef __sflight_image_fingerprint_HPP__
+#define __sflight_image_fingerprint_HPP__
+
+#include <cstdint>
+
+namespace sflight {
+namespace mdls { class Player; }
+namespace image {
+
+// a 64 bit hash (FNV-1a) of the player as an image holds it, configuration,
+// tables and modules, and of its current state (see Codec::saveState).  Two
+// players built from the same model and in the same state have the same
+// fingerprint; an input log is only replayed into a player that matches the
+// one it was recorded from.
+std::uint64_t fingerprint(mdls::Player&);
+}
+}
+
+#endif
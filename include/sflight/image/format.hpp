@@ -0,0 +1,90 @@
+
+#ifndef __sflight_image_format_HPP__
+#define __sflight_image_format_HPP__
+
+#include <cstdint>
+
+//
+// Layout of a compiled model image.  All values are stored in the byte order
+// of the machine that wrote the image, which the loader checks with
+// 'byteOrder'.  Offsets are in bytes from the start of the image.
+//
+//    Header
+//    player block          Player state, already in SI units
+//    module blocks         parameters of each module
+//    ModuleEntry[]         one per module, in update order
+//
+// A block is a sequence of 8-byte words (doubles, or integers for counts,
+// flags and enumerations); a string is its length followed by its characters,
+// padded to a whole word.  A table is written in place as a TableEntry, the
+// breakpoints of each axis and then the values, aligned to 64 bytes and in
+// the layout used by GridTable, so a loaded table points straight at them.
+//
+
+namespace sflight {
+namespace image {
+
+const char magic[8]{'S', 'F', 'L', 'T', 'I', 'M', 'G', '\0'};
+const std::uint32_t version{7};
+const std::uint32_t byteOrder{0x01020304};
+
+enum class ModuleType : std::uint32_t {
+   NONE = 0,
+   EOM_FIVE_DOF,
+   INTERP_AERO,
+   TABLE_AERO,
+   AUTO_PILOT,
+   ENGINE,
+   ATMOSPHERE,
+   WAYPOINT_FOLLOWER,
+   STICK_CONTROL,
+   FILE_OUTPUT,
+   INVERSE_DESIGN,
+   EOM_SIX_DOF
+};
+
+class Header
+{
+ public:
+   char magic[8]{};
+   std::uint32_t version{};
+   std::uint32_t byteOrder{};
+   std::uint64_t size{};
+
+   std::uint64_t playerOffset{};
+   std::uint64_t playerSize{};
+
+   std::uint64_t modulesOffset{};
+   std::uint64_t numModules{};
+};
+
+class ModuleEntry
+{
+ public:
+   ModuleType type{};
+   std::uint32_t reserved{};
+   double frameTime{};
+
+   std::uint64_t offset{};
+   std::uint64_t size{};
+};
+
+class TableEntry
+{
+ public:
+   static const std::uint32_t maxRank{6};
+
+   std::uint32_t rank{};
+   std::uint32_t layout{};
+   std::uint64_t numVals[maxRank]{};
+   // bit i set if axis i is clamped
+   std::uint64_t clamp{};
+   // offsets of the breakpoints and of the values
+   std::uint64_t valsOffset{};
+   std::uint64_t dataOffset{};
+   std::uint64_t dataSize{};
+};
+}
+}
+
+#endif
@@ -3,6 +3,7 @@
 #define __sflight_mdls_AutoPilotCmds_HPP__
 
 namespace sflight {
+namespace image { class Codec; }
 namespace mdls {
 
 //------------------------------------------------------------------------------
@@ -76,6 +77,9 @@ class AutoPilotCmds
    void setMaxVS(const double x)                     { maxVS = x;          }
    double getMaxVS() const                           { return maxVS;       }
 
+   friend class image::Codec;
+   friend class Inputs;
+
  private:
    double vel {};
    double alt {};        // meters
@@ -22,11 +22,11 @@ public:
     void getDeltaEuler(Euler &deltaEuler, double p, double q, double r );
     void getPQR(Vector3 &pqr, Vector3 &eulerDot);
 
-    double getPsi()                     { return a1;  }
+    double getPsi() const               { return a1;  }
     void setPsi(const double x)         { a1 = x;     }
-    double getTheta()                   { return a2;  }
+    double getTheta() const             { return a2;  }
     void setTheta(const double x)       { a2 = x;     }
-    double getPhi()                     { return a3;  }
+    double getPhi() const               { return a3;  }
     void setPhi(const double x)         { a3 = x;     }
 };
 
@@ -0,0 +1,109 @@
+
+#ifndef __sflight_mdls_GridTable_HPP__
+#define __sflight_mdls_GridTable_HPP__
+
+#include "sflight/mdls/TableAxis.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: GridTable
+// Description: Multilinear interpolation on a rectangular grid of any rank up
+//              to maxRank.  Breakpoints and values share a single allocation,
+//              with the values aligned to a cache line.
+//
+//              With the CELL layout (the default) the values are stored once
+//              per cell, the 2^rank corners of a cell side by side, so a lookup
+//              reads one contiguous block: 32 bytes in 2-D, 64 bytes (one cache
+//              line) in 3-D.  This costs up to 2^rank times the memory of the
+//              ROW_MAJOR layout, which stores each value once with the last
+//              axis varying fastest.
+//
+//              Interpolation is done along the last axis first, then the one
+//              before it, and so on; for a 3-D table this gives the same result
+//              as Table3D with the same breakpoints and data.  Outside the grid
+//              values are extrapolated from the first or last interval.
+//
+//              A table may also be laid over breakpoints and values owned by
+//              someone else, such as a mapped model image; nothing is copied
+//              and the memory must outlive the table.  The values are only
+//              copied, into memory of the table's own, the first time they are
+//              changed, so such memory is never written.
+//------------------------------------------------------------------------------
+class GridTable
+{
+ public:
+   enum class Layout { ROW_MAJOR, CELL };
+
+   static const std::size_t maxRank{6};
+
+   GridTable() = delete;
+   // one vector of increasing breakpoints per axis
+   GridTable(const std::vector<std::vector<double>>& breakpoints,
+             const Layout layout = Layout::CELL);
+   // a table over external memory: 'breakpoints' holds the breakpoints of every
+   // axis back to back, 'values' the getDataSize(numVals, layout) values in the
+   // table's own layout (aligned to 64 bytes for the CELL layout to pay off)
+   GridTable(const std::vector<std::size_t>& numVals, const double* breakpoints, double* values,
+             const Layout layout = Layout::CELL);
+   GridTable(const GridTable&) = delete;
+   GridTable& operator=(const GridTable&) = delete;
+   virtual ~GridTable() = default;
+
+   std::size_t getRank() const                              { return rank;              }
+   Layout getLayout() const                                 { return layout;            }
+   std::size_t getNumVals(const std::size_t axis) const     { return axes[axis].size(); }
+   const double* getVals(const std::size_t axis) const      { return vals[axis];        }
+   TableAxis& getAxis(const std::size_t axis)               { return axes[axis];        }
+
+   // values in the table's own layout
+   const double* getData() const                            { return data;              }
+   std::size_t getDataSize() const                          { return dataSize;          }
+   static std::size_t getDataSize(const std::vector<std::size_t>& numVals, const Layout layout);
+
+   // the 2^rank corner values of the cell with lower breakpoints 'low' (CELL layout)
+   const double* getCorners(const std::size_t low[]) const;
+
+   // sets all values, given in row-major order (last axis varying fastest)
+   void setData(const std::vector<double>&);
+
+   void set(const std::size_t index[], const double val);
+   double get(const std::size_t index[]) const;
+   void multiply(const double val);
+
+   // 'x' holds one value per axis
+   double interp(const double x[]);
+
+   void print() const;
+
+ private:
+   void checkRank() const;
+   void setup(const std::size_t numVals[]);
+   // gives a table over external memory values of its own, before a change
+   void copyData();
+
+   std::size_t rank{};
+   Layout layout{};
+
+   TableAxis axes[maxRank];
+   const double* vals[maxRank]{};
+
+   // intervals per axis (one for an axis with a single breakpoint)
+   std::size_t cells[maxRank]{};
+   // distance between neighbours along each axis, in values (ROW_MAJOR) or cells (CELL)
+   std::size_t strides[maxRank]{};
+   std::size_t numCorners{};
+
+   std::unique_ptr<double[]> storage;
+   double* data{};
+   std::size_t dataSize{};
+};
+}
+}
+
+#endif
@@ -0,0 +1,56 @@
+
+#ifndef __sflight_mdls_Histogram_HPP__
+#define __sflight_mdls_Histogram_HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: Histogram
+// Description: Counts of non-negative integer values (e.g. nanoseconds) in
+//              log-linear buckets: values below 32 have a bucket each, and
+//              every power of two above is split into 32 buckets, so a bucket
+//              is within about 3% of the values it holds.  Recording is a few
+//              instructions and never allocates.
+//------------------------------------------------------------------------------
+class Histogram
+{
+ public:
+   static const std::size_t subBits{5};
+   static const std::size_t numBuckets{(64 - subBits + 1) << subBits};
+
+   void record(const std::uint64_t x);
+   void clear();
+   // adds in the values recorded by another histogram
+   void add(const Histogram&);
+
+   std::uint64_t getCount() const                            { return count;  }
+   std::uint64_t getMin() const                              { return min;    }
+   std::uint64_t getMax() const                              { return max;    }
+   double getMean() const;
+
+   // the smallest value at or above the given fraction (0 to 1) of the values
+   // recorded, to the resolution of the buckets
+   std::uint64_t getPercentile(const double fraction) const;
+
+   // bucket contents: the lowest value each bucket holds and its count
+   static std::uint64_t getBucketLow(const std::size_t bucket);
+   std::uint64_t getBucketCount(const std::size_t bucket) const { return buckets[bucket]; }
+
+ private:
+   static std::size_t getBucket(const std::uint64_t x);
+
+   std::array<std::uint64_t, numBuckets> buckets{};
+   std::uint64_t count{};
+   std::uint64_t min{};
+   std::uint64_t max{};
+   double sum{};
+};
+}
+}
+
+#endif
@@ -0,0 +1,62 @@
+
+#ifndef __sflight_mdls_Inertia_HPP__
+#define __sflight_mdls_Inertia_HPP__
+
+#include "sflight/mdls/Vector3.hpp"
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: Inertia
+// Description: Inertia tensor of a rigid body about its body axes (kg-m2).
+//              Products of inertia are given as integrals (Ixz = sum x z dm),
+//              so they appear negated in the tensor.  The inverse is worked
+//              out when the tensor is set.
+//------------------------------------------------------------------------------
+class Inertia
+{
+ public:
+   Inertia() = default;
+   Inertia(const double ixx, const double iyy, const double izz, const double ixy = 0,
+           const double ixz = 0, const double iyz = 0);
+
+   // returns false, leaving no inverse, if the tensor is singular
+   bool set(const double ixx, const double iyy, const double izz, const double ixy = 0,
+            const double ixz = 0, const double iyz = 0);
+
+   // true once an invertible tensor has been set
+   bool isValid() const                          { return valid;          }
+
+   double getIxx() const                         { return tensor[0][0];   }
+   double getIyy() const                         { return tensor[1][1];   }
+   double getIzz() const                         { return tensor[2][2];   }
+   double getIxy() const                         { return -tensor[0][1];  }
+   double getIxz() const                         { return -tensor[0][2];  }
+   double getIyz() const                         { return -tensor[1][2];  }
+
+   // ret = I * v
+   void multiply(Vector3& ret, const Vector3& v) const
+   {
+      ret.set1(tensor[0][0] * v.a1 + tensor[0][1] * v.a2 + tensor[0][2] * v.a3);
+      ret.set2(tensor[1][0] * v.a1 + tensor[1][1] * v.a2 + tensor[1][2] * v.a3);
+      ret.set3(tensor[2][0] * v.a1 + tensor[2][1] * v.a2 + tensor[2][2] * v.a3);
+   }
+
+   // ret = inverse(I) * v
+   void solve(Vector3& ret, const Vector3& v) const
+   {
+      ret.set1(inverse[0][0] * v.a1 + inverse[0][1] * v.a2 + inverse[0][2] * v.a3);
+      ret.set2(inverse[1][0] * v.a1 + inverse[1][1] * v.a2 + inverse[1][2] * v.a3);
+      ret.set3(inverse[2][0] * v.a1 + inverse[2][1] * v.a2 + inverse[2][2] * v.a3);
+   }
+
+ private:
+   double tensor[3][3]{};
+   double inverse[3][3]{};
+   bool valid{};
+};
+}
+}
+
+#endif
@@ -0,0 +1,156 @@
+
+#ifndef __sflight_mdls_InputLog_HPP__
+#define __sflight_mdls_InputLog_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+//
+// Layout of an input log, in the byte order of the machine that wrote it
+// (checked with 'byteOrder' when it is read):
+//
+//    InputLogHeader
+//    records               one per frame on which inputs changed
+//
+// A record is the frames since the previous record (or since 'startFrame'),
+// a mask of the inputs changed (bit i for input i of Inputs) and, for each of
+// them, the bits of the new value XORed with the bits of the value the frame
+// before left, in reverse bit order; all three are unsigned LEB128 varints.
+// Reversed, the XOR of values with short mantissas, like a flag switched or
+// a throttle going from 0.5 to 1, takes 1 to 4 bytes; a value that differs in
+// its low mantissa bits, as most commands in SI units and stick deflections
+// do, takes 9 or 10.  A record with an empty mask ends the log, on the frame
+// the recording stopped.
+//
+// 'modelHash' is the fingerprint (see image::fingerprint) of the player the
+// recording started from; a log is only replayed into a player that has it.
+//
+
+namespace sflight {
+namespace mdls {
+class Player;
+
+namespace inputlog {
+const char magic[8]{'S', 'F', 'L', 'T', 'I', 'N', 'P', '\0'};
+const std::uint32_t version{2};
+const std::uint32_t byteOrder{0x01020304};
+}
+
+class InputLogHeader
+{
+ public:
+   char magic[8]{};
+   std::uint32_t version{};
+   std::uint32_t byteOrder{};
+   std::uint32_t numInputs{};
+   std::uint32_t reserved{};
+   std::uint64_t startFrame{};
+   double frameTime{};
+   std::uint64_t modelHash{};
+};
+
+//------------------------------------------------------------------------------
+// Class: Inputs
+// Description: The player fields set from outside the model: stick
+//              deflections, throttle and the autopilot commands, as doubles
+//              (flags as 0 or 1).  Values are read and written exactly, with
+//              no conversion on the way.
+//------------------------------------------------------------------------------
+class Inputs
+{
+ public:
+   static const std::size_t size{22};
+
+   static void get(const Player&, double x[size]);
+   static void set(Player&, const std::size_t index, const double x);
+};
+
+//------------------------------------------------------------------------------
+// Class: InputRecorder
+// Description: Logs the inputs given to a player as it runs.  Each frame, the
+//              inputs that differ from what the previous frame left are
+//              written, so a log holds only the changes made from outside.
+//------------------------------------------------------------------------------
+class InputRecorder
+{
+ public:
+   InputRecorder() = default;
+   InputRecorder(const InputRecorder&) = delete;
+   InputRecorder& operator=(const InputRecorder&) = delete;
+   ~InputRecorder();
+
+   // starts a log of the player from its current frame; 'modelHash' is the
+   // player's fingerprint, which a replay has to match
+   bool open(const std::string& filename, const Player&, const double frameTime,
+             const std::uint64_t modelHash);
+   // ends the log at the player's current frame
+   void close();
+   bool isOpen() const                                       { return file != nullptr; }
+
+   // logs the inputs changed since the last frame, then runs the frame
+   void update(Player&, const double timestep);
+
+ private:
+   void write(std::uint64_t x);
+
+   std::FILE* file{};
+   std::uint64_t lastFrame{};
+   // the frame the player is on (close() is given no player)
+   std::uint64_t frame{};
+   // the inputs as the last frame left them
+   std::uint64_t settled[Inputs::size]{};
+};
+
+//------------------------------------------------------------------------------
+// Class: InputReplay
+// Description: Feeds the inputs of a log back to a player that starts on the
+//              frame, and in the state, the recording started from; the player
+//              then runs exactly as the recorded one did.  A player on another
+//              frame, or with another fingerprint, is refused.
+//------------------------------------------------------------------------------
+class InputReplay
+{
+ public:
+   InputReplay() = default;
+   InputReplay(const InputReplay&) = delete;
+   InputReplay& operator=(const InputReplay&) = delete;
+   ~InputReplay();
+
+   // false unless the player is on the log's first frame and 'modelHash',
+   // its fingerprint, is the one the log was recorded from
+   bool open(const std::string& filename, const Player&, const std::uint64_t modelHash);
+   void close();
+   bool isOpen() const                                       { return file != nullptr; }
+
+   std::uint64_t getStartFrame() const                       { return header.startFrame; }
+   double getFrameTime() const                               { return header.frameTime;  }
+   std::uint64_t getModelHash() const                        { return header.modelHash;  }
+
+   // true once the player has reached the frame the recording stopped on
+   bool isDone(const Player&) const;
+   // false if the log is truncated or does not follow the player's frames
+   bool isGood() const                                       { return good;             }
+
+   // applies the inputs logged for the player's frame, then runs it
+   void update(Player&, const double timestep);
+
+ private:
+   bool read(std::uint64_t& x);
+   // reads the next record; 'nextMask' is left 0 at the end of the log
+   void next();
+
+   std::FILE* file{};
+   InputLogHeader header;
+   bool good{};
+
+   std::uint64_t nextFrame{};
+   std::uint64_t nextMask{};
+   std::uint64_t nextValues[Inputs::size]{};
+   std::uint64_t settled[Inputs::size]{};
+};
+}
+}
+
+#endif
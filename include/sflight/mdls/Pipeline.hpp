@@ -0,0 +1,171 @@
+
+#ifndef __sflight_mdls_Pipeline_HPP__
+#define __sflight_mdls_Pipeline_HPP__
+
+#include "sflight/mdls/Scheduler.hpp"
+#include "sflight/mdls/modules/Module.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: Pipeline
+// Description: Runs a player's modules in place of its scheduler, with the same
+//              ticks, timesteps and order (see Scheduler).
+//------------------------------------------------------------------------------
+class Pipeline
+{
+ public:
+   virtual ~Pipeline() = default;
+
+   virtual void build(const double tickTime) = 0;
+   virtual void run(const std::uint64_t tick, const double simTime) = 0;
+};
+
+//------------------------------------------------------------------------------
+// Class: StaticPipeline
+// Description: A pipeline for one fixed sequence of module types.  Each module
+//              is called through its own type, not through Module, so a frame
+//              makes no virtual calls and, with link time optimization (as in
+//              Release builds), the compiler sees every update it runs.  The
+//              modules due on each tick of the hyperperiod are tabled at build
+//              as a bit per module, as Scheduler tables its lists.
+//
+//              create() returns null unless the modules are exactly of the
+//              types Ms, in that order; the pipeline does not own them.
+//------------------------------------------------------------------------------
+template <class... Ms>
+class StaticPipeline : public Pipeline
+{
+ public:
+   static const std::size_t size{sizeof...(Ms)};
+   static_assert(size <= 64, "a pipeline holds at most 64 modules");
+
+   static std::unique_ptr<Pipeline> create(const std::vector<Module*>& modules)
+   {
+      if (modules.size() != size) {
+         return nullptr;
+      }
+      std::unique_ptr<StaticPipeline> x(new StaticPipeline);
+      if (!x->bind(modules, std::index_sequence_for<Ms...>())) {
+         return nullptr;
+      }
+      return x;
+   }
+
+   void build(const double tickTime) override
+   {
+      hyperperiod = 1;
+      for (std::size_t i = 0; i < size; i++) {
+         periods[i] = Scheduler<Module>::getPeriod(bases[i]->frameTime, tickTime);
+         timesteps[i] = static_cast<double>(periods[i]) * tickTime;
+
+         // least common multiple of the periods, unless it gets too long to table
+         std::uint64_t a{hyperperiod};
+         std::uint64_t b{periods[i]};
+         while (b != 0) {
+            const std::uint64_t r{a % b};
+            a = b;
+            b = r;
+         }
+         if (hyperperiod <= Scheduler<Module>::maxTable) {
+            hyperperiod = hyperperiod / a * periods[i];
+         }
+      }
+
+      dueOfPhase.clear();
+      if (hyperperiod <= Scheduler<Module>::maxTable) {
+         dueOfPhase.resize(hyperperiod);
+         for (std::uint64_t phase = 0; phase < hyperperiod; phase++) {
+            dueOfPhase[phase] = getDue(phase);
+         }
+      }
+   }
+
+   void run(const std::uint64_t tick, const double simTime) override
+   {
+      const std::uint64_t due{dueOfPhase.empty() ? getDue(tick)
+                                                 : dueOfPhase[tick % hyperperiod]};
+      run(due, simTime, std::index_sequence_for<Ms...>());
+   }
+
+ private:
+   StaticPipeline() = default;
+
+   template <std::size_t... I>
+   bool bind(const std::vector<Module*>& modules, std::index_sequence<I...>)
+   {
+      const bool match[]{(typeid(*modules[I]) == typeid(Ms))...};
+      for (std::size_t i = 0; i < size; i++) {
+         if (!match[i]) {
+            return false;
+         }
+      }
+      stages = std::make_tuple(static_cast<Ms*>(modules[I])...);
+      for (std::size_t i = 0; i < size; i++) {
+         bases[i] = modules[i];
+      }
+      return true;
+   }
+
+   // a bit for each module due on the tick
+   std::uint64_t getDue(const std::uint64_t tick) const
+   {
+      std::uint64_t due{};
+      for (std::size_t i = 0; i < size; i++) {
+         if ((tick + 1) % periods[i] == 0) {
+            due |= std::uint64_t(1) << i;
+         }
+      }
+      return due;
+   }
+
+   template <std::size_t... I>
+   void run(const std::uint64_t due, const double simTime, std::index_sequence<I...>)
+   {
+      // expands to one step per module, in order
+      const int steps[]{(step<I>(due, simTime), 0)...};
+      (void)steps;
+   }
+
+   template <std::size_t I>
+   void step(const std::uint64_t due, const double simTime)
+   {
+      using M = typename std::tuple_element<I, std::tuple<Ms...>>::type;
+      if (due & (std::uint64_t(1) << I)) {
+         bases[I]->lastTime = simTime;
+         std::get<I>(stages)->M::update(timesteps[I]);
+      }
+   }
+
+   std::tuple<Ms*...> stages;
+   Module* bases[size]{};
+   std::uint64_t periods[size]{};
+   double timesteps[size]{};
+   std::uint64_t hyperperiod{};
+   // modules due on each tick of the hyperperiod, when short enough to table
+   std::vector<std::uint64_t> dueOfPhase;
+};
+
+using PipelineFactory = std::unique_ptr<Pipeline> (*)(const std::vector<Module*>&);
+
+// adds a pipeline to those tried by selectPipeline, ahead of the ones already
+// known, e.g. addPipeline(StaticPipeline<EOMFiveDOF, Atmosphere>::create)
+void addPipeline(const PipelineFactory);
+
+// gives the player the first known pipeline that fits its modules; returns
+// false, and leaves the player on its scheduler, if there is none
+bool selectPipeline(Player* const);
+}
+}
+
+#endif
@@ -6,12 +6,17 @@
 
 #include "sflight/mdls/AutoPilotCmds.hpp"
 #include "sflight/mdls/Euler.hpp"
+#include "sflight/mdls/Inertia.hpp"
+#include "sflight/mdls/Pipeline.hpp"
+#include "sflight/mdls/Profiler.hpp"
 #include "sflight/mdls/Quaternion.hpp"
+#include "sflight/mdls/Scheduler.hpp"
 #include "sflight/mdls/Vector3.hpp"
 #include "sflight/mdls/nav_utils.hpp"
 
 #include "sflight/xml_bindings/init_Player.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace sflight {
@@ -19,7 +24,9 @@ namespace xml {
 class Node;
 }
 namespace mdls {
+class Atmosphere;
 class Module;
+class PlayerField;
 
 //------------------------------------------------------------------------------
 // Class: Player
@@ -35,6 +42,28 @@ public:
    void addModule(Module* const module);
    void update(const double timestep);
 
+   // runs the modules through the pipeline, not the scheduler, until another
+   // module is added (see selectPipeline)
+   void setPipeline(std::unique_ptr<Pipeline> x);
+   Pipeline* getPipeline() const                { return pipeline.get(); }
+
+   // times every module update while on; the modules then run through the
+   // scheduler even if there is a pipeline.  Off costs one test per frame.
+   void setProfiling(const bool x);
+   Profiler* getProfiler() const                { return profiler.get(); }
+
+   // the Atmosphere module among the modules, null if there is none
+   const Atmosphere* getAtmosphere() const      { return atmosphere; }
+
+   // attitude (body to earth), normalized
+   const Quaternion& getAttitude() const        { return attitude; }
+   void setAttitude(const Quaternion& x)        { attitude = x; eulersValid = false; }
+
+   // euler angles (psi, theta, phi), worked out from the attitude when first
+   // read after it changes
+   const Euler& getEulers() const;
+   void setEulers(const Euler& x);
+
    friend void xml_bindings::init_Player(xml::Node* const, Player*);
 
    // lat, lon (radians) and alt (meters)
@@ -87,9 +116,6 @@ public:
    // angular accel (rad/s2)
    Vector3 pqrdot;
 
-   // euler angles (psi, theta, phi)
-   Euler eulers;
-
    // thrust in the [x, y, z] directions (newtons)
    Vector3 thrust;
 
@@ -111,8 +137,8 @@ public:
    // control surface deflections [aileron elevator rudder] (radians)
    Vector3 deflections;
 
-   // Inertia (also a matrix that is the inertia tensor)
-   // Inertia inertia = new Inertia();
+   // inertia tensor about the body axes (kg-m2)
+   Inertia inertia;
 
    // background wind vel [north east down]  without turbulence (m/s)
    Vector3 windVel;
@@ -135,6 +161,26 @@ public:
    AutoPilotCmds autoPilotCmds;
 
    std::vector<Module*> modules{};
+
+   // modules in rate groups, rebuilt when a module is added or the frame time
+   // changes, and the frame, time and frame time the schedule started from,
+   // valid once set by update() or restored from a snapshot
+   Scheduler<Module> scheduler;
+   std::size_t scheduleFrame{};
+   double scheduleTime{};
+   double scheduleTickTime{};
+   bool hasScheduleOrigin{};
+
+   friend const std::vector<PlayerField>& getPlayerFields();
+
+private:
+   std::unique_ptr<Pipeline> pipeline;
+   std::unique_ptr<Profiler> profiler;
+   const Atmosphere* atmosphere{};
+
+   Quaternion attitude;
+   mutable Euler eulers;
+   mutable bool eulersValid{true};
 };
 }
 }
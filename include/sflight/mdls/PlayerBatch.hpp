@@ -0,0 +1,152 @@
+
+#ifndef __sflight_mdls_PlayerBatch_HPP__
+#define __sflight_mdls_PlayerBatch_HPP__
+
+#include "sflight/mdls/AutoPilotCmds.hpp"
+#include "sflight/mdls/Scheduler.hpp"
+#include "sflight/mdls/Vector3Array.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class BatchAtmosphere;
+class BatchModule;
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: PlayerBatch
+// Description: A fleet of aircraft of the same type.  The state found in
+//              Player is stored in structure-of-arrays form (one array per
+//              field, one entry per aircraft) and each batch module advances
+//              every aircraft in a single update call.
+//------------------------------------------------------------------------------
+class PlayerBatch
+{
+public:
+   PlayerBatch() = default;
+   PlayerBatch(const PlayerBatch&) = delete;
+   PlayerBatch& operator=(const PlayerBatch&) = delete;
+   ~PlayerBatch();
+
+   // copies the state of a configured player into a new batch entry and
+   // returns the index of that entry
+   std::size_t add(Player* const);
+
+   // copies the state of a batch entry back into a player
+   void get(const std::size_t index, Player* const) const;
+
+   std::size_t size() const                     { return count; }
+
+   // the values of the Player member at 'offset' (see PlayerField), entry i of
+   // the batch at [i * stride]; the stride is 0 for a value all aircraft share,
+   // and null is returned for a member the batch does not hold.  The arrays
+   // move when aircraft are added.
+   const double* getField(const std::size_t offset, std::size_t* const stride) const;
+
+   // the BatchAtmosphere module among the modules, null if there is none
+   const BatchAtmosphere* getAtmosphere() const { return atmosphere; }
+
+   void addModule(BatchModule* const module);
+   void update(const double timestep);
+
+   // lat, lon (radians) and alt (meters)
+   std::vector<double> lat;
+   std::vector<double> lon;
+   std::vector<double> alt;
+
+   // mass (kg)
+   std::vector<double> mass;
+
+   // air density (kg/m3)
+   std::vector<double> rho;
+
+   // magnitude of vehicle true airspeed (m/s)
+   std::vector<double> vInf;
+
+   // mach number
+   std::vector<double> mach;
+
+   // angle of attack and sideslip (radians) and their rates (rad/sec)
+   std::vector<double> alpha;
+   std::vector<double> beta;
+   std::vector<double> alphaDot;
+   std::vector<double> betaDot;
+
+   // altitude above ground and terrain elevation (meters)
+   std::vector<double> altagl;
+   std::vector<double> terrainElev;
+
+   // gravitational accel (m/s2)
+   std::vector<double> g;
+
+   // body axis velocities, accelerations, angular rates and angular accels
+   Vector3Array uvw;
+   Vector3Array uvwdot;
+   Vector3Array pqr;
+   Vector3Array pqrdot;
+
+   // attitude quaternion (body to earth), normalized and carried from step to
+   // step as in Player
+   std::vector<double> qw;
+   std::vector<double> qx;
+   std::vector<double> qy;
+   std::vector<double> qz;
+
+   // euler angles (a1 = psi, a2 = theta, a3 = phi), worked out from the attitude
+   Vector3Array eulers;
+
+   // propulsion and aero forces (newtons) and moments (newton-m)
+   Vector3Array thrust;
+   Vector3Array thrustMoment;
+   Vector3Array aeroForce;
+   Vector3Array aeroMoment;
+
+   // velocity in the earth plane [vnorth, veast, vdown] (m/s)
+   Vector3Array nedVel;
+
+   // position in the x-y-z coordinates [north, east, down] from starting point (meters)
+   Vector3Array xyz;
+
+   // control surface deflections [aileron elevator rudder] (radians)
+   Vector3Array deflections;
+
+   // background wind vel and gust [north east down] (m/s)
+   Vector3Array windVel;
+   Vector3Array windGust;
+
+   // engine-related values
+   std::vector<double> throttle;
+   std::vector<double> rpm;
+   std::vector<double> fuel;     // kilos
+   std::vector<double> fuelflow; // kilos/sec
+
+   // Autopilot commands
+   std::vector<AutoPilotCmds> autoPilotCmds;
+
+   // sim related items (the whole batch advances in lock step)
+   std::size_t frameNum{};
+   double simTime{};
+   bool paused{true};
+
+   std::vector<BatchModule*> modules{};
+
+   // the configuration of each module of the model the batch was built from
+   // (as image::Codec writes it); a batch holds a single model
+   std::vector<std::vector<char>> configuration{};
+
+   // modules in rate groups, rebuilt when a module is added or the frame time
+   // changes, and the frame and time the schedule started from
+   Scheduler<BatchModule> scheduler;
+   std::size_t scheduleFrame{};
+   double scheduleTime{};
+
+private:
+   std::size_t count{};
+   const BatchAtmosphere* atmosphere{};
+};
+}
+}
+
+#endif
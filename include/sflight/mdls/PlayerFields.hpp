@@ -0,0 +1,45 @@
+
+#ifndef __sflight_mdls_PlayerFields_HPP__
+#define __sflight_mdls_PlayerFields_HPP__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: PlayerField
+// Description: A value of the player state that can be written out: where it
+//              is in Player, and how it is shown (unit, conversion from SI and
+//              number of decimals).
+//------------------------------------------------------------------------------
+class PlayerField
+{
+ public:
+   const char* name{""};
+   // shown unit, empty for none
+   const char* unit{""};
+   // SI value to the shown unit, or null if shown as is
+   double (*convert)(const double){};
+   int precision{4};
+
+   std::size_t offset{};
+
+   double get(const Player& player) const;
+
+   // "Name(unit)", or the name alone
+   std::string getTitle() const;
+};
+
+// every field that can be written, the columns FileOutput writes by default first
+const std::vector<PlayerField>& getPlayerFields();
+
+// the field with the given name, or null
+const PlayerField* findPlayerField(const std::string& name);
+}
+}
+
+#endif
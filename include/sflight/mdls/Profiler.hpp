@@ -0,0 +1,65 @@
+
+#ifndef __sflight_mdls_Profiler_HPP__
+#define __sflight_mdls_Profiler_HPP__
+
+#include "sflight/mdls/Histogram.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class Module;
+
+//------------------------------------------------------------------------------
+// Class: Profiler
+// Description: Time spent in module updates, in nanoseconds.  A player that
+//              profiles (see Player::setProfiling) has one entry per module, in
+//              update order.  Adding profilers together merges entries of the
+//              same module class, so the sum over a set of players gives the
+//              cost of each class.
+//------------------------------------------------------------------------------
+class Profiler
+{
+ public:
+   class Entry
+   {
+    public:
+      // module class, without namespaces
+      std::string name;
+      // nanoseconds in total, and per update
+      std::uint64_t total{};
+      Histogram times;
+   };
+
+   // one entry per module; entries already there are kept
+   void setModules(const std::vector<Module*>&);
+
+   void record(const std::size_t index, const std::uint64_t nanoseconds)
+   {
+      entries[index].total += nanoseconds;
+      entries[index].times.record(nanoseconds);
+   }
+
+   // adds in the entries of another profiler, by class
+   void add(const Profiler&);
+   void clear();
+
+   const std::vector<Entry>& getEntries() const              { return entries; }
+   std::uint64_t getTotal() const;
+
+   // one line per entry: calls, total, mean and percentiles
+   void print(std::ostream&) const;
+
+   static std::string getName(const Module&);
+
+ private:
+   std::vector<Entry> entries;
+};
+}
+}
+
+#endif
@@ -21,19 +21,21 @@ class Quaternion
    Quaternion();
    Quaternion(const double psi, const double theta, const double phi);
    Quaternion(const double eo, const double ex, const double ey, const double ez);
-   Quaternion(Euler& euler);
+   Quaternion(const Euler& euler);
    virtual ~Quaternion();
 
-   double getPsi();
-   double getTheta();
-   double getPhi();
+   double getPsi() const;
+   double getTheta() const;
+   double getPhi() const;
 
-   void getEulers(Euler& euler);
-   void getDxDyDz(Vector3& dxdydz, Vector3& uvw);
-   void getUVW(Vector3& uvw, Vector3& dxdydz);
-   void getQdot(Quaternion& toFill, double p, double q, double r);
+   void getEulers(Euler& euler) const;
+   void getDxDyDz(Vector3& dxdydz, const Vector3& uvw) const;
+   void getUVW(Vector3& uvw, const Vector3& dxdydz) const;
+   void getQdot(Quaternion& toFill, double p, double q, double r) const;
+   // the unit vector pointing down (earth axis) in body axes
+   void getDown(Vector3& down) const;
 
-   void initialize(Euler& euler);
+   void initialize(const Euler& euler);
    void initialize(double psi, double theta, double phi);
    void normalize();
    void add(Quaternion q);
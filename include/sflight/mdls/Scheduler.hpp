@@ -0,0 +1,206 @@
+
+#ifndef __sflight_mdls_Scheduler_HPP__
+#define __sflight_mdls_Scheduler_HPP__
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: Scheduler
+// Description: Runs modules on an integer tick base.  When built, each module
+//              gets a period of frameTime / tickTime ticks (rounded, at least
+//              one) and modules with the same period form a rate group.  A
+//              module runs on the ticks where (tick + 1) is a multiple of its
+//              period, with a timestep of exactly period * tickTime.
+//
+//              For every tick of the hyperperiod of the groups, the modules
+//              due are listed ahead of time in the order they were added, so
+//              a tick visits only the modules it runs.  Past 'maxTable' ticks
+//              the due groups are instead merged on each tick.
+//
+//              M is Module or BatchModule (frameTime, lastTime and update()).
+//              A profiler, if given, is any object with a
+//              record(index, nanoseconds) member (see Profiler).
+//------------------------------------------------------------------------------
+template <class M>
+class Scheduler
+{
+ public:
+   static const std::uint64_t maxTable{4096};
+
+   // ticks between updates of a module with the given frame time
+   static std::uint64_t getPeriod(const double frameTime, const double tickTime)
+   {
+      const double ticks{tickTime > 0 ? std::round(frameTime / tickTime) : 1};
+      return ticks > 1 ? static_cast<std::uint64_t>(ticks) : 1;
+   }
+
+   bool isBuilt() const                                      { return built;    }
+   double getTickTime() const                                { return tickTime; }
+   void clear()                                              { built = false;   }
+
+   void build(const std::vector<M*>& modules, const double tickTime);
+
+   // updates the modules due on 'tick' (the first tick after building is 0)
+   void run(const std::uint64_t tick, const double simTime);
+
+   // the same, timing each update and passing it to the profiler with the
+   // module's index
+   template <class P>
+   void run(const std::uint64_t tick, const double simTime, P& profiler);
+
+ private:
+   class Entry
+   {
+    public:
+      M* module{};
+      double timestep{};
+      std::size_t index{};
+   };
+
+   class RateGroup
+   {
+    public:
+      std::uint64_t period{};
+      std::vector<Entry> entries;
+   };
+
+   bool built{};
+   double tickTime{};
+
+   std::vector<RateGroup> groups;
+   std::uint64_t hyperperiod{};
+   // modules due, per distinct set of due groups, and which set each tick uses
+   std::vector<std::vector<Entry>> lists;
+   std::vector<std::size_t> listOfPhase;
+   std::vector<Entry> merged;
+
+   const std::vector<Entry>& getDue(const std::uint64_t tick);
+};
+
+template <class M>
+void Scheduler<M>::build(const std::vector<M*>& modules, const double x)
+{
+   built = true;
+   tickTime = x;
+   groups.clear();
+   lists.clear();
+   listOfPhase.clear();
+
+   for (std::size_t i = 0; i < modules.size(); i++) {
+      const std::uint64_t period{getPeriod(modules[i]->frameTime, tickTime)};
+
+      std::size_t g{};
+      while (g < groups.size() && groups[g].period != period) {
+         g++;
+      }
+      if (g == groups.size()) {
+         groups.emplace_back();
+         groups[g].period = period;
+      }
+      Entry entry;
+      entry.module = modules[i];
+      entry.timestep = static_cast<double>(period) * tickTime;
+      entry.index = i;
+      groups[g].entries.push_back(entry);
+   }
+
+   // least common multiple of the periods, unless it gets too long to table
+   hyperperiod = 1;
+   for (std::size_t g = 0; g < groups.size() && hyperperiod <= maxTable; g++) {
+      std::uint64_t a{hyperperiod};
+      std::uint64_t b{groups[g].period};
+      while (b != 0) {
+         const std::uint64_t r{a % b};
+         a = b;
+         b = r;
+      }
+      hyperperiod = hyperperiod / a * groups[g].period;
+   }
+   if (hyperperiod > maxTable || groups.size() > 64) {
+      return;
+   }
+
+   std::vector<std::uint64_t> keys;
+   listOfPhase.resize(hyperperiod);
+   for (std::uint64_t phase = 0; phase < hyperperiod; phase++) {
+      std::uint64_t key{};
+      for (std::size_t g = 0; g < groups.size(); g++) {
+         if ((phase + 1) % groups[g].period == 0) {
+            key |= std::uint64_t(1) << g;
+         }
+      }
+      std::size_t n{};
+      while (n < keys.size() && keys[n] != key) {
+         n++;
+      }
+      if (n == keys.size()) {
+         keys.push_back(key);
+         lists.emplace_back();
+         for (std::size_t g = 0; g < groups.size(); g++) {
+            if (key & (std::uint64_t(1) << g)) {
+               lists[n].insert(lists[n].end(), groups[g].entries.begin(), groups[g].entries.end());
+            }
+         }
+         std::sort(lists[n].begin(), lists[n].end(),
+                   [](const Entry& a, const Entry& b) { return a.index < b.index; });
+      }
+      listOfPhase[phase] = n;
+   }
+}
+
+template <class M>
+auto Scheduler<M>::getDue(const std::uint64_t tick) -> const std::vector<Entry>&
+{
+   if (!listOfPhase.empty()) {
+      return lists[listOfPhase[tick % hyperperiod]];
+   }
+   merged.clear();
+   for (std::size_t g = 0; g < groups.size(); g++) {
+      if ((tick + 1) % groups[g].period == 0) {
+         merged.insert(merged.end(), groups[g].entries.begin(), groups[g].entries.end());
+      }
+   }
+   std::sort(merged.begin(), merged.end(),
+             [](const Entry& a, const Entry& b) { return a.index < b.index; });
+   return merged;
+}
+
+template <class M>
+void Scheduler<M>::run(const std::uint64_t tick, const double simTime)
+{
+   const std::vector<Entry>& due{getDue(tick)};
+   for (std::size_t i = 0; i < due.size(); i++) {
+      const Entry& entry{due[i]};
+      entry.module->lastTime = simTime;
+      entry.module->update(entry.timestep);
+   }
+}
+
+template <class M>
+template <class P>
+void Scheduler<M>::run(const std::uint64_t tick, const double simTime, P& profiler)
+{
+   using Clock = std::chrono::steady_clock;
+   const std::vector<Entry>& due{getDue(tick)};
+   for (std::size_t i = 0; i < due.size(); i++) {
+      const Entry& entry{due[i]};
+      entry.module->lastTime = simTime;
+      const Clock::time_point start{Clock::now()};
+      entry.module->update(entry.timestep);
+      const Clock::time_point end{Clock::now()};
+      profiler.record(entry.index, static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+   }
+}
+}
+}
+
+#endif
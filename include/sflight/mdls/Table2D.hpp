@@ -2,6 +2,8 @@
 #ifndef __sflight_mdls_Table2D_HPP__
 #define __sflight_mdls_Table2D_HPP__
 
+#include "sflight/mdls/TableAxis.hpp"
+
 #include <string>
 #include <cstddef>
 
@@ -42,6 +44,10 @@ public:
 
    double* rowVals{};
    double* colVals{};
+
+   // breakpoint lookup
+   TableAxis rowAxis;
+   TableAxis colAxis;
 };
 
 }
@@ -3,6 +3,7 @@
 #define __sflight_mdls_Table3D_HPP__
 
 #include "sflight/mdls/Table2D.hpp"
+#include "sflight/mdls/TableAxis.hpp"
 
 #include <cstddef>
 
@@ -30,6 +31,7 @@ private:
    Table2D** data{};
    double* pageVals{};
    std::size_t numPages{};
+   TableAxis pageAxis;
 };
 
 }
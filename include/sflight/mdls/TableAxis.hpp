@@ -0,0 +1,60 @@
+
+#ifndef __sflight_mdls_TableAxis_HPP__
+#define __sflight_mdls_TableAxis_HPP__
+
+#include <cstddef>
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: TableAxis
+// Description: Breakpoint lookup for one axis of a table.  find() returns the
+//              lower breakpoint of the interval used to interpolate a value;
+//              values below the first or above the last breakpoint use the
+//              first or last interval (and are extrapolated).
+//
+//              The interval found by the previous call is tried first, since
+//              queries change little from one frame to the next.  Otherwise
+//              the index is computed directly when the breakpoints are evenly
+//              spaced, or found by binary search.
+//------------------------------------------------------------------------------
+class TableAxis
+{
+public:
+   TableAxis() = default;
+   // 'vals' must be increasing; the axis does not take ownership
+   TableAxis(const double vals[], const std::size_t size);
+
+   std::size_t size() const                     { return n;       }
+   bool isUniform() const                       { return uniform; }
+
+   std::size_t find(const double x);
+
+   // fraction of the way from breakpoint i to i + 1
+   double getWeight(const std::size_t i, const double x) const
+   {
+      return n > 1 ? (x - vals[i]) / (vals[i + 1] - vals[i]) : 0.0;
+   }
+
+private:
+   bool contains(const std::size_t i, const double x) const
+   {
+      return (i == 0 || vals[i] <= x) && (i + 2 == n || x < vals[i + 1]);
+   }
+
+   const double* vals{};
+   std::size_t n{};
+
+   // evenly spaced breakpoints
+   bool uniform{};
+   double first{};
+   double invStep{};
+
+   // interval found by the last call
+   std::size_t hint{};
+};
+}
+}
+
+#endif
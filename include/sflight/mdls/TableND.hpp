@@ -0,0 +1,159 @@
+
+#ifndef __sflight_mdls_TableND_HPP__
+#define __sflight_mdls_TableND_HPP__
+
+#include "sflight/mdls/GridTable.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: TableNDLerp
+// Description: Interpolates the 2^(Rank - Axis) corner values 'v' along axes
+//              Axis to Rank - 1, using the weights 'w'; unrolled at compile time
+//------------------------------------------------------------------------------
+template <std::size_t Rank, std::size_t Axis>
+class TableNDLerp
+{
+ public:
+   static double apply(const double* v, const double* w)
+   {
+      const std::size_t half{std::size_t(1) << (Rank - 1 - Axis)};
+      const double low{TableNDLerp<Rank, Axis + 1>::apply(v, w)};
+      const double high{TableNDLerp<Rank, Axis + 1>::apply(v + half, w)};
+      return low + (high - low) * w[Axis];
+   }
+};
+
+template <std::size_t Rank>
+class TableNDLerp<Rank, Rank>
+{
+ public:
+   static double apply(const double* v, const double*) { return v[0]; }
+};
+
+//------------------------------------------------------------------------------
+// Class: TableND
+// Description: Table of fixed rank on a GridTable (CELL layout), for 4-D and
+//              5-D databases as well as the usual 2-D and 3-D ones.  Each axis
+//              either extrapolates beyond its breakpoints (the default, as
+//              Table2D and Table3D do) or clamps to them.  A lookup makes no
+//              virtual calls and no allocations, and gives the same result as
+//              GridTable::interp.
+//------------------------------------------------------------------------------
+template <std::size_t Rank>
+class TableND
+{
+   static_assert(Rank > 0 && Rank <= GridTable::maxRank, "TableND rank out of range");
+
+ public:
+   TableND() = delete;
+   // one vector of increasing breakpoints per axis
+   TableND(const std::vector<std::vector<double>>& breakpoints) : grid(checkRank(breakpoints)) {}
+   // a table over external memory (see GridTable)
+   TableND(const std::vector<std::size_t>& numVals, const double* breakpoints, double* values)
+       : grid(checkRank(numVals), breakpoints, values) {}
+
+   static constexpr std::size_t getRank()                    { return Rank;          }
+   GridTable& getGrid()                                      { return grid;          }
+
+   void setData(const std::vector<double>& x)                { grid.setData(x);      }
+   void multiply(const double val)                           { grid.multiply(val);   }
+   void print() const                                        { grid.print();         }
+
+   bool getClamp(const std::size_t axis) const               { return clamp[axis];   }
+   void setClamp(const std::size_t axis, const bool x)       { clamp[axis] = x;      }
+
+   double interp(const double x[Rank])
+   {
+      std::size_t low[Rank];
+      double weight[Rank];
+      for (std::size_t i = 0; i < Rank; i++) {
+         find(i, x[i], low[i], weight[i]);
+      }
+      return TableNDLerp<Rank, 0>::apply(grid.getCorners(low), weight);
+   }
+
+   //
+   // out[j] = interp({x[0][j], x[1][j], ...}) for j in [0, n).  Queries are
+   // handled in blocks: corners and weights are gathered first, then blended
+   // one axis at a time across the block in loops the compiler can vectorize.
+   //
+   void interpBatch(const double* const x[Rank], double out[], const std::size_t n)
+   {
+      const std::size_t numCorners{std::size_t(1) << Rank};
+      const std::size_t blockSize{32};
+
+      // the whole block is always blended (a fixed trip count vectorizes at
+      // -O2), so it starts zeroed
+      double v[numCorners][blockSize]{};
+      double weight[Rank][blockSize]{};
+
+      for (std::size_t start = 0; start < n; start += blockSize) {
+         const std::size_t m{n - start < blockSize ? n - start : blockSize};
+
+         for (std::size_t j = 0; j < m; j++) {
+            std::size_t low[Rank];
+            for (std::size_t i = 0; i < Rank; i++) {
+               find(i, x[i][start + j], low[i], weight[i][j]);
+            }
+            const double* corners{grid.getCorners(low)};
+            for (std::size_t c = 0; c < numCorners; c++) {
+               v[c][j] = corners[c];
+            }
+         }
+
+         // same order as TableNDLerp: last axis first
+         std::size_t count{numCorners};
+         for (std::size_t i = Rank; i-- > 0;) {
+            count /= 2;
+            for (std::size_t c = 0; c < count; c++) {
+               for (std::size_t j = 0; j < blockSize; j++) {
+                  v[c][j] = v[2 * c][j] + (v[2 * c + 1][j] - v[2 * c][j]) * weight[i][j];
+               }
+            }
+         }
+
+         for (std::size_t j = 0; j < m; j++) {
+            out[start + j] = v[0][j];
+         }
+      }
+   }
+
+ private:
+   void find(const std::size_t i, const double x, std::size_t& low, double& weight)
+   {
+      TableAxis& axis{grid.getAxis(i)};
+      double xi{x};
+      if (clamp[i]) {
+         const double* vals{grid.getVals(i)};
+         const double first{vals[0]};
+         const double last{vals[axis.size() - 1]};
+         xi = xi < first ? first : (xi > last ? last : xi);
+      }
+      low = axis.find(xi);
+      weight = axis.getWeight(low, xi);
+   }
+
+   template <class T>
+   static const std::vector<T>& checkRank(const std::vector<T>& axes)
+   {
+      if (axes.size() != Rank) {
+         std::cout << "TableND<" << Rank << "> given " << axes.size() << " axes" << std::endl;
+         std::exit(0);
+      }
+      return axes;
+   }
+
+   GridTable grid;
+   bool clamp[Rank]{};
+};
+}
+}
+
+#endif
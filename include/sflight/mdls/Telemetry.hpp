@@ -0,0 +1,101 @@
+
+#ifndef __sflight_mdls_Telemetry_HPP__
+#define __sflight_mdls_Telemetry_HPP__
+
+#include "sflight/mdls/PlayerFields.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+//
+// Layout of a binary telemetry log, in the byte order of the machine that
+// wrote it (checked with 'byteOrder' when it is read):
+//
+//    TelemetryHeader
+//    TelemetryChannel[]    one per channel, in column order
+//    frames                per output frame, the SI values of the channels due
+//                          on that frame (see Channels::gather)
+//
+// Which channels a frame holds follows from its index and the decimation of
+// each channel, so frames carry no other data.  Converting a log gives the
+// same text columns FileOutput writes.
+//
+
+namespace sflight {
+namespace mdls {
+class Player;
+
+namespace telemetry {
+const char magic[8]{'S', 'F', 'L', 'T', 'T', 'L', 'M', '\0'};
+const std::uint32_t version{2};
+const std::uint32_t byteOrder{0x01020304};
+}
+
+class TelemetryHeader
+{
+ public:
+   char magic[8]{};
+   std::uint32_t version{};
+   std::uint32_t byteOrder{};
+   std::uint32_t numChannels{};
+   std::uint32_t reserved{};
+};
+
+class TelemetryChannel
+{
+ public:
+   static const std::size_t maxName{32};
+
+   // field name, null-terminated
+   char name[maxName]{};
+   std::uint64_t decimation{};
+};
+
+//------------------------------------------------------------------------------
+// Class: Channels
+// Description: The player fields chosen for output, compiled into a table of
+//              offsets.  A channel with decimation n is sampled on every n-th
+//              output frame only.
+//------------------------------------------------------------------------------
+class Channels
+{
+ public:
+   // the columns FileOutput has always written
+   static Channels standard();
+
+   // false if there is no field with that name
+   bool add(const std::string& name, const std::size_t decimation = 1);
+
+   std::size_t size() const                                  { return fields.size();  }
+   bool empty() const                                        { return fields.empty(); }
+   const PlayerField& getField(const std::size_t i) const    { return *fields[i];     }
+   std::size_t getDecimation(const std::size_t i) const      { return decimations[i]; }
+
+   // number of channels due on output frame 'frame'
+   std::size_t count(const std::size_t frame) const;
+   // SI values of the channels due on 'frame', in channel order; returns how many
+   std::size_t gather(const Player&, const std::size_t frame, double* const packed) const;
+   // spreads the values gathered on 'frame' over one value per channel, leaving
+   // channels not due with their last value
+   void scatter(const std::size_t frame, const double* const packed, double* const values) const;
+
+ private:
+   std::vector<const PlayerField*> fields;
+   std::vector<std::size_t> offsets;
+   std::vector<std::size_t> decimations;
+};
+
+// column titles and one line of text columns (one SI value per channel),
+// without the line end
+void writeTextHeader(std::ostream&, const Channels&);
+void writeText(std::ostream&, const Channels&, const double* const values);
+
+// writes a binary log as text columns; false if it cannot be read
+bool convertTelemetry(const std::string& logFilename, const std::string& textFilename);
+}
+}
+
+#endif
@@ -0,0 +1,69 @@
+
+#ifndef __sflight_mdls_TelemetryWriter_HPP__
+#define __sflight_mdls_TelemetryWriter_HPP__
+
+#include "sflight/mdls/Telemetry.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace sflight {
+namespace mdls {
+class TelemetryDrain;
+
+//------------------------------------------------------------------------------
+// Class: TelemetryWriter
+// Description: Writes a binary telemetry log without blocking the simulation.
+//              Values are copied into a single-producer ring; one background
+//              thread, shared by the open writers and stopped when the last
+//              one closes, empties the rings to disk in batches, woken early
+//              when a ring passes half full.  The producer waits only if its
+//              ring is full.
+//
+//              A log is complete once its writer is closed or destroyed.
+//------------------------------------------------------------------------------
+class TelemetryWriter
+{
+ public:
+   // 'capacity' is rounded up to a power of two values, allocated when opened
+   TelemetryWriter(const std::size_t capacity = 8192);
+   TelemetryWriter(const TelemetryWriter&) = delete;
+   TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+   ~TelemetryWriter();
+
+   // starts a log of the given channels
+   bool open(const std::string& filename, const Channels&);
+   // writes everything queued and closes the log
+   void close();
+   bool isOpen() const                                       { return file != nullptr; }
+
+   // queues the values of one frame; called from one thread at a time
+   void write(const double* const values, const std::size_t n);
+
+   friend class TelemetryDrain;
+
+ private:
+   // writes the queued values, returning how many (background thread)
+   std::size_t drain();
+
+   // the background thread, held while the log is open
+   std::shared_ptr<TelemetryDrain> drainer;
+
+   std::unique_ptr<double[]> ring;
+   std::size_t mask{};
+   std::FILE* file{};
+
+   // next value to write and next to drain, kept on separate cache lines
+   char pad0[64]{};
+   std::atomic<std::size_t> head{};
+   char pad1[64]{};
+   std::atomic<std::size_t> tail{};
+   char pad2[64]{};
+};
+}
+}
+
+#endif
@@ -21,6 +21,7 @@ class UnitConvert
    static inline double toSqMeters(const double sqFeet);
    static inline double toFeet(const double meters);
    static inline double toSqFeet(const double sqMeters);
+   static inline double toKgSqMeters(const double slugSqFeet);
    static inline double toMPS(const double knots);
    static inline double toKnots(const double metersPerSecond);
    static inline double toKilos(const double lbs);
@@ -48,6 +49,9 @@ double UnitConvert::toFeet(const double meters) { return meters / 0.3048; }
 
 double UnitConvert::toSqFeet(const double sqMeters) { return sqMeters / 0.3048 / 0.3048; }
 
+/** converts a moment of inertia in slug-ft2 to kg-m2 */
+double UnitConvert::toKgSqMeters(const double slugSqFeet) { return slugSqFeet * 1.3558179483; }
+
 /** converts knots to Meters per second */
 double UnitConvert::toMPS(const double knots) { return knots / 1.9438445; }
 
@@ -0,0 +1,37 @@
+
+#ifndef __sflight_mdls_Vector3Array_HPP__
+#define __sflight_mdls_Vector3Array_HPP__
+
+#include <cstddef>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class Vector3;
+
+//------------------------------------------------------------------------------
+// Class: Vector3Array
+// Description: Structure-of-arrays storage for many 3-D vectors; component
+//              'a1' of every vector is contiguous, and so on
+//------------------------------------------------------------------------------
+class Vector3Array
+{
+ public:
+   Vector3Array() = default;
+   virtual ~Vector3Array() = default;
+
+   std::size_t size() const                     { return a1.size(); }
+   void resize(const std::size_t n);
+   void push_back(const Vector3& v);
+
+   void get(const std::size_t index, Vector3& v) const;
+   void set(const std::size_t index, const Vector3& v);
+
+   std::vector<double> a1;
+   std::vector<double> a2;
+   std::vector<double> a3;
+};
+}
+}
+
+#endif
@@ -0,0 +1,36 @@
+
+#ifndef __sflight_mdls_BatchAtmosphere_HPP__
+#define __sflight_mdls_BatchAtmosphere_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+
+namespace sflight {
+namespace mdls {
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchAtmosphere
+// Description: Batch version of Atmosphere
+//------------------------------------------------------------------------------
+class BatchAtmosphere : public BatchModule
+{
+ public:
+   BatchAtmosphere(PlayerBatch*, const Atmosphere& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+   Atmosphere::Model getModel() const           { return model; }
+
+   // the model of the batch's BatchAtmosphere module, the table if it has none
+   static Atmosphere::Model getModel(const PlayerBatch&);
+
+ private:
+   Atmosphere::Model model{Atmosphere::Model::TABLE};
+};
+}
+}
+
+#endif
@@ -0,0 +1,54 @@
+
+#ifndef __sflight_mdls_BatchAutoPilot_HPP__
+#define __sflight_mdls_BatchAutoPilot_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class AutoPilot;
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchAutoPilot
+// Description: Batch version of AutoPilot
+//------------------------------------------------------------------------------
+class BatchAutoPilot : public BatchModule
+{
+ public:
+   BatchAutoPilot(PlayerBatch*, const AutoPilot& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+   void updateHdg(const std::size_t index, const double timestep, const double cmdHdg);
+   void updateAlt(const std::size_t index, const double timestep);
+   void updateVS(const std::size_t index, const double timestep, const double cmdVs);
+   void updateSpeed(const std::size_t index, const double timestep);
+
+ private:
+   double kphi{};
+   double maxBankRate{};
+   double kalt{};
+   double kpitch{};
+   double maxG{};
+   double minG{};
+   double maxG_rate{};
+   double minG_rate{};
+
+   double maxThrottle{};
+   double minThrottle{};
+   double spoolTime{};
+
+   bool trajectoryTurn{};
+
+   // vertical speed of the previous update, one entry per aircraft
+   std::vector<double> lastVz;
+};
+}
+}
+
+#endif
@@ -0,0 +1,34 @@
+
+#ifndef __sflight_mdls_BatchEngine_HPP__
+#define __sflight_mdls_BatchEngine_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+namespace sflight {
+namespace mdls {
+class Engine;
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchEngine
+// Description: Batch version of Engine
+//------------------------------------------------------------------------------
+class BatchEngine : public BatchModule
+{
+ public:
+   BatchEngine(PlayerBatch*, const Engine& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+ private:
+   double thrustAngle{};
+   double seaLevelTemp{};
+   double seaLevelPress{};
+   double staticThrust{};
+   double staticFF{};
+};
+}
+}
+
+#endif
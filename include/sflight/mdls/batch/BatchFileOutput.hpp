@@ -0,0 +1,60 @@
+
+#ifndef __sflight_mdls_BatchFileOutput_HPP__
+#define __sflight_mdls_BatchFileOutput_HPP__
+
+#include "sflight/mdls/Telemetry.hpp"
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class FileOutput;
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchFileOutput
+// Description: Batch version of FileOutput, for text output only.  Each output
+//              frame holds one row per aircraft, in batch order, so a batch of
+//              one writes the same file as FileOutput.  No file is written
+//              when the filename is empty.
+//------------------------------------------------------------------------------
+class BatchFileOutput : public BatchModule
+{
+ public:
+   BatchFileOutput(PlayerBatch*, const FileOutput& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+   const std::string& getFilename() const                    { return filename; }
+   void setFilename(const std::string& x)                    { filename = x;    }
+
+ private:
+   void open();
+   void update();
+
+   std::string filename;
+   Channels channels;
+   bool opened{};
+
+   // where each channel is found in the batch, and the stride of its array
+   std::vector<const double*> sources;
+   std::vector<std::size_t> strides;
+   // one line of values, and the last value of each decimated channel of each
+   // aircraft, for the frames the channel is not due
+   std::vector<double> row;
+   std::vector<double> held;
+
+   std::ofstream fout;
+   int rate{};
+   // time of the last output frame
+   double outputTime{};
+   int frameCounter{};
+};
+}
+}
+
+#endif
@@ -0,0 +1,52 @@
+
+#ifndef __sflight_mdls_BatchInterpAero_HPP__
+#define __sflight_mdls_BatchInterpAero_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+namespace sflight {
+namespace mdls {
+class InterpAero;
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchInterpAero
+// Description: Batch version of InterpAero
+//------------------------------------------------------------------------------
+class BatchInterpAero : public BatchModule
+{
+ public:
+   BatchInterpAero(PlayerBatch*, const InterpAero& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+ private:
+   double wingArea{};
+
+   double a1{};
+   double a2{};
+   double b1{};
+   double b2{};
+
+   bool usingMachEffects{};
+
+   // moment derivatives (see InterpAero)
+   double wingSpan{};
+   double cruiseAlpha{};
+   bool hasMoments{};
+   double chord{};
+   double clBeta{};
+   double clP{};
+   double clAileron{};
+   double cmAlpha{};
+   double cmQ{};
+   double cmElevator{};
+   double cnBeta{};
+   double cnR{};
+   double cnRudder{};
+};
+}
+}
+
+#endif
@@ -0,0 +1,44 @@
+
+#ifndef __sflight_mdls_BatchInverseDesign_HPP__
+#define __sflight_mdls_BatchInverseDesign_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+namespace sflight {
+namespace mdls {
+class InverseDesign;
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchInverseDesign
+// Description: Batch version of InverseDesign
+//------------------------------------------------------------------------------
+class BatchInverseDesign : public BatchModule
+{
+ public:
+   BatchInverseDesign(PlayerBatch*, const InverseDesign& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+ private:
+   double wingArea{};
+
+   double staticThrust{};
+   double staticTSFC{};
+   double thrustAngle{};
+   double dTdM{};
+   double dTdRho{};
+   double dTSFCdM{};
+
+   double cdo{};
+   double clo{};
+   double a{};
+   double b{};
+
+   bool usingMachEffects{};
+};
+}
+}
+
+#endif
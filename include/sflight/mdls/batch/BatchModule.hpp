@@ -0,0 +1,33 @@
+
+#ifndef __sflight_mdls_BatchModule_HPP__
+#define __sflight_mdls_BatchModule_HPP__
+
+namespace sflight {
+namespace mdls {
+class Module;
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchModule
+// Description: Base class for all modules that advance a whole PlayerBatch.
+//              Batch modules are created from a configured (prototype) module
+//              and share its parameters across every aircraft in the batch.
+//------------------------------------------------------------------------------
+class BatchModule
+{
+ public:
+   BatchModule(PlayerBatch*, const Module& prototype);
+   virtual ~BatchModule() = default;
+
+   // module interface
+   virtual void update(const double timestep){};
+
+   PlayerBatch* batch{};
+
+   double frameTime{};
+   double lastTime{};
+};
+}
+}
+
+#endif
@@ -0,0 +1,34 @@
+
+#ifndef __sflight_mdls_BatchStickControl_HPP__
+#define __sflight_mdls_BatchStickControl_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+namespace sflight {
+namespace mdls {
+class PlayerBatch;
+class StickControl;
+
+//------------------------------------------------------------------------------
+// Class: BatchStickControl
+// Description: Batch version of StickControl
+//------------------------------------------------------------------------------
+class BatchStickControl : public BatchModule
+{
+ public:
+   BatchStickControl(PlayerBatch*, const StickControl& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+ private:
+   double designQbar{};
+   double elevGain{};
+   double rudGain{};
+   double ailGain{};
+   double pitchGain{};
+};
+}
+}
+
+#endif
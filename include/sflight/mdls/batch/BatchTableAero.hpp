@@ -0,0 +1,49 @@
+
+#ifndef __sflight_mdls_BatchTableAero_HPP__
+#define __sflight_mdls_BatchTableAero_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+#include "sflight/mdls/TableND.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class PlayerBatch;
+class TableAero;
+
+//------------------------------------------------------------------------------
+// Class: BatchTableAero
+// Description: Batch version of TableAero; each table is evaluated for the
+//              whole fleet with one interpBatch() call.  The tables are shared
+//              with the prototype module.
+//------------------------------------------------------------------------------
+class BatchTableAero : public BatchModule
+{
+ public:
+   BatchTableAero(PlayerBatch*, const TableAero& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+ private:
+   double wingArea{};
+   double thrustAngle{};
+
+   // shared with the prototype, which may go first
+   std::shared_ptr<TableND<3>> liftTable;
+   std::shared_ptr<TableND<3>> dragTable;
+   std::shared_ptr<TableND<3>> thrustTable;
+   std::shared_ptr<TableND<3>> fuelflowTable;
+
+   // per aircraft results
+   std::vector<double> cl;
+   std::vector<double> cd;
+   std::vector<double> thrust;
+};
+}
+}
+
+#endif
@@ -0,0 +1,52 @@
+
+#ifndef __sflight_mdls_BatchWaypointFollower_HPP__
+#define __sflight_mdls_BatchWaypointFollower_HPP__
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+#include "sflight/mdls/modules/WaypointFollower.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+class PlayerBatch;
+
+//------------------------------------------------------------------------------
+// Class: BatchWaypointFollower
+// Description: Batch version of WaypointFollower.  Every aircraft flies the
+//              prototype's route, each keeping its own place along it.
+//------------------------------------------------------------------------------
+class BatchWaypointFollower : public BatchModule
+{
+ public:
+   BatchWaypointFollower(PlayerBatch*, const WaypointFollower& prototype);
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+ private:
+   void loadWaypoint(const std::size_t index);
+   void setState(const std::size_t index, const bool isOn);
+
+   std::vector<Waypoint> waypoints;
+   bool bearing{};
+
+   // state of the prototype, given to aircraft as they join the batch
+   std::size_t startWp{};
+   std::size_t startWpNum{};
+   double startDistTol{};
+   bool startOn{};
+
+   // one entry per aircraft; 'currentWp' is an index into waypoints, or
+   // 'none' while no waypoint is loaded
+   static const std::size_t none{static_cast<std::size_t>(-1)};
+   std::vector<std::size_t> currentWp;
+   std::vector<std::size_t> wpNum;
+   std::vector<double> distTol;
+   std::vector<char> isOn;
+};
+}
+}
+
+#endif
@@ -0,0 +1,59 @@
+
+#ifndef __sflight_mdls_eom_kernel_HPP__
+#define __sflight_mdls_eom_kernel_HPP__
+
+#include <cstddef>
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+// arrays read and written by the vectorized five DOF equations of motion
+enum EOMField {
+   LAT, LON, ALT, MASS, ALTAGL, G,
+   VINF, ALPHA, BETA, ALPHADOT, BETADOT,
+   U, V, W, UDOT, VDOT, WDOT,
+   P, Q, R, PDOT, QDOT, RDOT,
+   PSI, THETA, PHI,
+   QW, QX, QY, QZ,
+   AERO_X, AERO_Y, AERO_Z,
+   THRUST_X, THRUST_Y, THRUST_Z,
+   WIND_N, WIND_E, WIND_D,
+   VN, VE, VD,
+   X, Y, Z,
+   NUM_EOM_FIELDS
+};
+
+//------------------------------------------------------------------------------
+// Class: EOMLanes
+// Description: One pointer per EOMField, each to an array with an entry per
+//              aircraft
+//------------------------------------------------------------------------------
+class EOMLanes
+{
+ public:
+   double* field[NUM_EOM_FIELDS]{};
+};
+
+//------------------------------------------------------------------------------
+// Class: EOMParams
+//------------------------------------------------------------------------------
+class EOMParams
+{
+ public:
+   double timestep{};
+   double grav{};      // gravitational accel (m/s2)
+   double gravConst{}; // accel used to normalize the "g" term (m/s2)
+   bool autoRudder{};
+};
+
+// integrate 'n' aircraft, two (sse2), four (avx2) or eight (avx512) at a time;
+// the mach number is not computed by the kernels
+void eomKernelSSE2(const EOMLanes&, const std::size_t n, const EOMParams&);
+void eomKernelAVX2(const EOMLanes&, const std::size_t n, const EOMParams&);
+void eomKernelAVX512(const EOMLanes&, const std::size_t n, const EOMParams&);
+}
+}
+}
+
+#endif
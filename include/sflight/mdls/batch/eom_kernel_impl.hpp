@@ -0,0 +1,204 @@
+
+#ifndef __sflight_mdls_eom_kernel_impl_HPP__
+#define __sflight_mdls_eom_kernel_impl_HPP__
+
+#include "sflight/mdls/batch/eom_kernel.hpp"
+#include "sflight/mdls/batch/simd_math.hpp"
+
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <cstddef>
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+//
+// Integrates the lanes [i, i + Vec::width) of the five DOF equations of motion.
+// This follows BatchEOMFiveDOF::computeEOM step for step, with one algebraic
+// shortcut: the cube in the wgs84 radius of curvature is a product instead of a
+// call to pow().
+//
+template <class Vec>
+inline void eomStep(double* const* f, const std::size_t i, const EOMParams& k)
+{
+   const Vec zero{0.0};
+   const Vec half{0.5};
+   const Vec two{2.0};
+   const Vec dt{k.timestep};
+
+   // the attitude is carried from step to step, normalized
+   Vec eo{Vec::load(f[QW] + i)};
+   Vec ex{Vec::load(f[QX] + i)};
+   Vec ey{Vec::load(f[QY] + i)};
+   Vec ez{Vec::load(f[QZ] + i)};
+
+   Vec u{Vec::load(f[U] + i)};
+   Vec v{Vec::load(f[V] + i)};
+   Vec w{Vec::load(f[W] + i)};
+   Vec p{Vec::load(f[P] + i)};
+   Vec q{Vec::load(f[Q] + i)};
+   Vec r{Vec::load(f[R] + i)};
+
+   // set the accel based on angular rates.
+   Vec udot{r * v - q * w};
+   Vec vdot{k.autoRudder ? zero : (zero - r) * u + p * w};
+   Vec wdot{q * u - p * v};
+
+   // get gravity acceleration for current orientation (see Quaternion::getDown)
+   const Vec grav{k.grav};
+   const Vec gx{two * (ex * ez - ey * eo) * grav};
+   const Vec gy{two * (ey * ez + ex * eo) * grav};
+   const Vec gz{(ez * ez + eo * eo - ex * ex - ey * ey) * grav};
+
+   // set the "g" term
+   ((wdot + gz) / Vec(k.gravConst)).store(f[G] + i);
+
+   // add gravity, aero and propulsion accels to uvwdot
+   const Vec invMass{Vec(1.0) / Vec::load(f[MASS] + i)};
+   udot = udot + gx + (Vec::load(f[AERO_X] + i) + Vec::load(f[THRUST_X] + i)) * invMass;
+   vdot = vdot + gy + (Vec::load(f[AERO_Y] + i) + Vec::load(f[THRUST_Y] + i)) * invMass;
+   wdot = wdot + gz + (Vec::load(f[AERO_Z] + i) + Vec::load(f[THRUST_Z] + i)) * invMass;
+
+   // compute new velocity vector
+   u = u + udot * dt;
+   v = v + vdot * dt;
+   w = w + wdot * dt;
+
+   // compute the new aero angles
+   const Vec vInf{sqrt(u * u + v * v + w * w)};
+   vInf.store(f[VINF] + i);
+   atan2(w, u).store(f[ALPHA] + i);
+   atan2(wdot, u).store(f[ALPHADOT] + i);
+   const Vec betaDot{asin(vdot / vInf)};
+   betaDot.store(f[BETADOT] + i);
+
+   // adjust yaw rate to match change in beta (no-slip condition)
+   if (k.autoRudder) {
+      r = betaDot;
+      zero.store(f[BETA] + i);
+      v = zero;
+   } else {
+      asin(v / vInf).store(f[BETA] + i);
+   }
+
+   // test for on ground condition and prevent downward accel if true
+   const auto onGround = Vec::load(f[ALTAGL] + i) < zero;
+   q = select(onGround & (Vec::load(f[THETA] + i) < zero), select(q > zero, q, zero), q);
+   w = select(onGround, select(w < zero, w, zero), w);
+   wdot = select(onGround, select(wdot < zero, wdot, zero), wdot);
+
+   // integrate pqrdot and add to pqr
+   p = p + Vec::load(f[PDOT] + i) * dt;
+   q = q + Vec::load(f[QDOT] + i) * dt;
+   r = r + Vec::load(f[RDOT] + i) * dt;
+
+   // adjust the quaternion based on the body angular rates and renormalize
+   const Vec hdt{half * dt};
+   const Vec deo{(zero - p * ex - q * ey - r * ez) * hdt};
+   const Vec dex{(p * eo + r * ey - q * ez) * hdt};
+   const Vec dey{(q * eo - r * ex + p * ez) * hdt};
+   const Vec dez{(r * eo + q * ex - p * ey) * hdt};
+   eo = eo + deo;
+   ex = ex + dex;
+   ey = ey + dey;
+   ez = ez + dez;
+   const Vec norm{sqrt(eo * eo + ex * ex + ey * ey + ez * ez)};
+   eo = eo / norm;
+   ex = ex / norm;
+   ey = ey / norm;
+   ez = ez / norm;
+
+   // new euler angles
+   atan2(two * (eo * ez + ex * ey), eo * eo + ex * ex - ey * ey - ez * ez).store(f[PSI] + i);
+   asin(two * (eo * ey - ex * ez)).store(f[THETA] + i);
+   atan2(two * (eo * ex + ey * ez), eo * eo + ez * ez - ex * ex - ey * ey).store(f[PHI] + i);
+
+   // compute the north, east, down velocities and add steady-state wind
+   const Vec vn{(ex * ex + eo * eo - ey * ey - ez * ez) * u + two * (ex * ey - ez * eo) * v +
+              two * (ex * ez + ey * eo) * w + Vec::load(f[WIND_N] + i)};
+   const Vec ve{two * (ex * ey + ez * eo) * u + (ey * ey + eo * eo - ex * ex - ez * ez) * v +
+              two * (ey * ez - ex * eo) * w + Vec::load(f[WIND_E] + i)};
+   const Vec vd{two * (ex * ez - ey * eo) * u + two * (ey * ez + ex * eo) * v +
+              (ez * ez + eo * eo - ex * ex - ey * ey) * w + Vec::load(f[WIND_D] + i)};
+
+   // integrate velocities to get new lat, lon (see nav::wgs84LatLon)
+   const Vec lat{Vec::load(f[LAT] + i)};
+   const Vec alt{Vec::load(f[ALT] + i)};
+   Vec sinLat, cosLat;
+   sincos(lat, sinLat, cosLat);
+   const Vec e2{nav::epsilon * nav::epsilon};
+   const Vec divisor{sqrt(Vec(1.0) - e2 * sinLat * sinLat)};
+   const Vec rMeridian{Vec(nav::radiusEq) * (Vec(1.0) - e2) / (divisor * divisor * divisor)};
+   const Vec rNormal{Vec(nav::radiusEq) / divisor};
+   (lat + vn / (rMeridian + alt) * dt).store(f[LAT] + i);
+   (Vec::load(f[LON] + i) + ve / ((rNormal + alt) * cosLat) * dt).store(f[LON] + i);
+
+   // update the position in x-y-z space
+   (Vec::load(f[X] + i) + vn * dt).store(f[X] + i);
+   (Vec::load(f[Y] + i) + ve * dt).store(f[Y] + i);
+   (Vec::load(f[Z] + i) + vd * dt).store(f[Z] + i);
+
+   // set the new alt (positive vel is downward)
+   (alt - vd * dt).store(f[ALT] + i);
+
+   // store the new state
+   u.store(f[U] + i);
+   v.store(f[V] + i);
+   w.store(f[W] + i);
+   udot.store(f[UDOT] + i);
+   vdot.store(f[VDOT] + i);
+   wdot.store(f[WDOT] + i);
+   p.store(f[P] + i);
+   q.store(f[Q] + i);
+   r.store(f[R] + i);
+   vn.store(f[VN] + i);
+   ve.store(f[VE] + i);
+   vd.store(f[VD] + i);
+   eo.store(f[QW] + i);
+   ex.store(f[QX] + i);
+   ey.store(f[QY] + i);
+   ez.store(f[QZ] + i);
+}
+
+//
+// Runs eomStep over all 'n' aircraft.  A partial vector at the end of the
+// arrays is copied into scratch lanes (padded with the last aircraft) so the
+// kernel never reads or writes past the end of the batch.
+//
+template <class Vec>
+inline void runEOMKernel(const EOMLanes& lanes, const std::size_t n, const EOMParams& k)
+{
+   const std::size_t width{Vec::width};
+
+   std::size_t i{};
+   for (; i + width <= n; i += width) {
+      eomStep<Vec>(lanes.field, i, k);
+   }
+
+   if (i < n) {
+      const std::size_t count{n - i};
+      double scratch[NUM_EOM_FIELDS][Vec::width];
+      double* f[NUM_EOM_FIELDS];
+
+      for (std::size_t j = 0; j < NUM_EOM_FIELDS; j++) {
+         f[j] = scratch[j];
+         for (std::size_t lane = 0; lane < width; lane++) {
+            scratch[j][lane] = lanes.field[j][lane < count ? i + lane : n - 1];
+         }
+      }
+
+      eomStep<Vec>(f, 0, k);
+
+      for (std::size_t j = 0; j < NUM_EOM_FIELDS; j++) {
+         for (std::size_t lane = 0; lane < count; lane++) {
+            lanes.field[j][i + lane] = scratch[j][lane];
+         }
+      }
+   }
+}
+}
+}
+}
+
+#endif
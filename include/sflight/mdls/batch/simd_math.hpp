@@ -0,0 +1,173 @@
+
+#ifndef __sflight_mdls_simd_math_HPP__
+#define __sflight_mdls_simd_math_HPP__
+
+#include <cstddef>
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+//------------------------------------------------------------------------------
+// Elementary functions for packed doubles.
+//
+// 'V' is a vector type that provides the arithmetic operators, comparisons
+// returning a mask type (combined with '&', '|' and '^'), and the free functions
+// select(mask, a, b), sqrt(), abs() and floor().  The polynomial approximations
+// and range reductions are those of the Cephes math library; over the ranges
+// used by the flight model they agree with the <cmath> functions to within a
+// few units in the last place.
+//------------------------------------------------------------------------------
+
+// evaluates c[0] * x^n + ... + c[n]
+template <class V>
+inline V polevl(const V x, const double* const c, const std::size_t n)
+{
+   V ans{c[0]};
+   for (std::size_t i = 1; i <= n; i++) {
+      ans = ans * x + V(c[i]);
+   }
+   return ans;
+}
+
+// evaluates x^(n+1) + c[0] * x^n + ... + c[n]
+template <class V>
+inline V p1evl(const V x, const double* const c, const std::size_t n)
+{
+   V ans{x + V(c[0])};
+   for (std::size_t i = 1; i <= n; i++) {
+      ans = ans * x + V(c[i]);
+   }
+   return ans;
+}
+
+// computes the sine and cosine of x
+template <class V>
+inline void sincos(const V x, V& s, V& c)
+{
+   static const double sincof[] = {1.58962301576546568060E-10, -2.50507477628578072866E-8,
+                                   2.75573136213857245213E-6,  -1.98412698295895385996E-4,
+                                   8.33333333332211858878E-3,  -1.66666666666666307295E-1};
+   static const double coscof[] = {-1.13585365213876817300E-11, 2.08757008419747316778E-9,
+                                   -2.75573141792967388112E-7,  2.48015872888517045348E-5,
+                                   -1.38888888888730564116E-3,  4.16666666666665929218E-2};
+   const double DP1{7.85398125648498535156E-1};
+   const double DP2{3.77489470793079817668E-8};
+   const double DP3{2.69515142907905952645E-15};
+   const double FOPI{1.27323954473516268615}; // 4/pi
+
+   const V zero{0.0};
+   const V ax{abs(x)};
+
+   // octant of |x|, forced even so the reduced argument lies in [-pi/4, pi/4]
+   V j{floor(ax * V(FOPI))};
+   j = j + select(j - V(2.0) * floor(j * V(0.5)) == V(1.0), V(1.0), zero);
+   const V y{j};
+   j = j - V(8.0) * floor(j * V(0.125));
+
+   const V z{((ax - y * V(DP1)) - y * V(DP2)) - y * V(DP3)};
+   const V zz{z * z};
+
+   const V ps{z + z * zz * polevl(zz, sincof, 5)};
+   const V pc{V(1.0) - V(0.5) * zz + zz * zz * polevl(zz, coscof, 5)};
+
+   // octants 4..7 flip the sign of both results, octants 2..5 that of the cosine
+   const auto upper = j > V(3.0);
+   j = j - select(upper, V(4.0), zero);
+   const auto swap = abs(j - V(1.5)) < V(1.0); // j is 1 or 2
+
+   const V sinv{select(swap, pc, ps)};
+   const V cosv{select(swap, ps, pc)};
+
+   s = select((x < zero) ^ upper, zero - sinv, sinv);
+   c = select(upper ^ (j > V(1.0)), zero - cosv, cosv);
+}
+
+// computes the arc tangent of x
+template <class V>
+inline V atan(const V x)
+{
+   static const double P[] = {-8.750608600031904122785E-1, -1.615753718733365076637E1,
+                              -7.500855792314704667340E1, -1.228866684490136173410E2,
+                              -6.485021904942025371773E1};
+   static const double Q[] = {2.485846490142306297962E1, 1.650270098316988542046E2,
+                              4.328810604912902668951E2, 4.853903996359136964868E2,
+                              1.945506571482613964425E2};
+   const double T3P8{2.41421356237309504880}; // tan(3 * pi / 8)
+   const double MOREBITS{6.123233995736765886130E-17};
+   const double PIO2{1.57079632679489661923};
+   const double PIO4{7.85398163397448309616E-1};
+
+   const V zero{0.0};
+   const V ax{abs(x)};
+
+   // reduce to |x| <= 0.66 using tan(pi/2 - z) and tan(pi/4 - z)
+   const auto big = ax > V(T3P8);
+   const auto mid = ax > V(0.66);
+
+   V y{select(big, V(PIO2), select(mid, V(PIO4), zero))};
+   V xr{select(big, zero - V(1.0) / ax, select(mid, (ax - V(1.0)) / (ax + V(1.0)), ax))};
+
+   const V z2{xr * xr};
+   V z{z2 * polevl(z2, P, 4) / p1evl(z2, Q, 4)};
+   z = xr * z + xr;
+   z = z + select(big, V(MOREBITS), select(mid, V(0.5 * MOREBITS), zero));
+   y = y + z;
+
+   return select(x < zero, zero - y, y);
+}
+
+// computes the arc tangent of y / x, using the signs of both arguments to
+// determine the quadrant of the result
+template <class V>
+inline V atan2(const V y, const V x)
+{
+   const double PI{3.14159265358979323846};
+   const V zero{0.0};
+
+   V z{atan(y / x)};
+   z = z + select(x < zero, select(y < zero, V(-PI), V(PI)), zero);
+
+   // atan2(0, 0) is zero, as in <cmath>
+   return select((x == zero) & (y == zero), zero, z);
+}
+
+// computes the arc sine of x
+template <class V>
+inline V asin(const V x)
+{
+   static const double P[] = {4.253011369004428248960E-3, -6.019598008014123785661E-1,
+                              5.444622390564711410273E0,  -1.626247967210700244449E1,
+                              1.956261983317594739197E1,  -8.198089802484824371615E0};
+   static const double Q[] = {-1.474091372988853791896E1, 7.049610280856842141659E1,
+                              -1.471791292232726029859E2, 1.395105614657485689735E2,
+                              -4.918853881490881290097E1};
+   static const double R[] = {2.967721961301243206100E-3, -5.634242780008963776856E-1,
+                              6.968710824104713396794E0, -2.556901049652824852289E1,
+                              2.853665548261061424989E1};
+   static const double S[] = {-2.194779531642920639778E1, 1.470656354026814941758E2,
+                              -3.838770957603691357202E2, 3.424398657913078477438E2};
+   const double MOREBITS{6.123233995736765886130E-17};
+   const double PIO4{7.85398163397448309616E-1};
+
+   const V zero{0.0};
+   const V a{abs(x)};
+
+   // |x| > 0.625
+   const V zz1{V(1.0) - a};
+   const V p{zz1 * polevl(zz1, R, 4) / p1evl(zz1, S, 3)};
+   const V s{sqrt(zz1 + zz1)};
+   const V large{((V(PIO4) - s) - (s * p - V(MOREBITS))) + V(PIO4)};
+
+   // |x| <= 0.625
+   const V zz2{a * a};
+   const V small{a * (zz2 * polevl(zz2, P, 5) / p1evl(zz2, Q, 4)) + a};
+
+   const V z{select(a > V(0.625), large, small)};
+   return select(x < zero, zero - z, z);
+}
+}
+}
+}
+
+#endif
@@ -4,10 +4,33 @@
 
 #include "sflight/mdls/modules/Module.hpp"
 
+#include "sflight/xml_bindings/init_Atmosphere.hpp"
+
+#include <cstddef>
+
 namespace sflight {
+namespace image {
+class Codec;
+}
+namespace xml {
+class Node;
+}
 namespace mdls {
 class Player;
 
+//------------------------------------------------------------------------------
+// Class: AtmosphereData
+// Description: Atmospheric properties at one altitude
+//------------------------------------------------------------------------------
+class AtmosphereData
+{
+ public:
+   double temp{};       // Kelvin
+   double pressure{};   // same units as Atmosphere::getPressure()
+   double rho{};        // kg/m^3
+   double speedSound{}; // mps
+};
+
 //------------------------------------------------------------------------------
 // Class: Atmosphere
 // Description: Implements a model of the 1976 standard atmosphere, based on
@@ -54,15 +77,50 @@ class Player;
 // 34000	-38.9	   6.5    0.0096
 // 35000	-36.1	   5.6    0.0082
 //
+// The module sets the player's density from the table above, or from the
+// analytic 1976 standard atmosphere (Model::ISA, up to 86 km), which has
+// continuous derivatives.  The modules that work out Mach or engine lapse
+// take temperature and pressure from the same model through the functions
+// that take a Model; the other static functions always use the table, as do
+// the design points worked out when a model is read.
 //------------------------------------------------------------------------------
 class Atmosphere : public Module
 {
  public:
+   enum class Model { TABLE, ISA };
+
    Atmosphere(Player*, const double frameRate);
 
    // module interface
    virtual void update(const double timestep) override;
 
+   Model getModel() const                       { return model; }
+
+   friend void xml_bindings::init_Atmosphere(xml::Node*, Atmosphere*);
+   friend class image::Codec;
+   friend class BatchAtmosphere;
+
+   // returns all properties from a single table lookup
+   static AtmosphereData getAll(const double alt_meters);
+
+   // same for 'n' altitudes; any output array may be null
+   static void getAll(const std::size_t n, const double alt_meters[], double temp[],
+                      double pressure[], double rho[], double speedSound[]);
+
+   // returns all properties from the analytic standard atmosphere
+   static AtmosphereData getAllISA(const double alt_meters);
+
+   // the model of the player's Atmosphere module, the table if it has none
+   static Model getModel(const Player&);
+
+   // getAll() and getAllISA() by model
+   static AtmosphereData getAll(const Model, const double alt_meters);
+   static void getAll(const Model, const std::size_t n, const double alt_meters[],
+                      double temp[], double pressure[], double rho[], double speedSound[]);
+
+   // returns speed of sound in mps at an altitude
+   static double getSpeedSound(const Model, const double alt_meters);
+
    // returns density in kg/m^3
    static double getRho(const double alt_meters);
 
@@ -86,6 +144,8 @@ class Atmosphere : public Module
    static const double dens[37];
 
    static int const maxIndex = 36;
+
+   Model model{Model::TABLE};
 };
 }
 }
@@ -7,6 +7,7 @@
 #include "sflight/xml_bindings/init_AutoPilot.hpp"
 
 namespace sflight {
+namespace image { class Codec; }
 namespace xml { class Node; }
 namespace mdls {
 class Player;
@@ -30,6 +31,8 @@ public:
    void updateSpeed(const double timestep);
 
    friend void xml_bindings::init_AutoPilot(xml::Node*, AutoPilot*);
+   friend class image::Codec;
+   friend class BatchAutoPilot;
 
 private:
    enum class TurnType { HDG = 0, TRAJECTORY = 1 };
@@ -9,7 +9,13 @@
 
 #include "sflight/xml_bindings/init_EOMFiveDOF.hpp"
 
+#include <array>
+#include <cstddef>
+
 namespace sflight {
+namespace image {
+class Codec;
+}
 namespace xml {
 class Node;
 }
@@ -20,10 +26,30 @@ class Player;
 // Class: EOMFiveDOF
 // Description: Implements psuedo five DOF dynamics for fixed wing aircraft
 //              (imposes a no-slip condition)
+//
+//              The state (body velocities and rates, attitude quaternion and
+//              position) is advanced with one of:
+//
+//                EULER            one rate evaluation per frame (the default)
+//                RK2              Heun's method, two evaluations
+//                RK4              classic Runge-Kutta, four evaluations
+//                ADAMS_BASHFORTH  third order, one evaluation; reuses the rates
+//                                 of the last two frames, so it restarts with
+//                                 an RK4 step when the timestep changes
+//                ADAPTIVE         Dormand-Prince 5(4) substeps within the frame,
+//                                 sized so the estimated error of each stays
+//                                 under 'tolerance' (in m, m/s, rad/s)
+//
+//              Forces, angular accelerations and wind are held at their values
+//              for the frame by every integrator.  The attitude is the player's
+//              quaternion, kept normalized; no integrator works with euler
+//              angles.
 //------------------------------------------------------------------------------
 class EOMFiveDOF : public Module
 {
  public:
+   enum class Integrator { EULER, RK2, RK4, ADAMS_BASHFORTH, ADAPTIVE };
+
    EOMFiveDOF(Player*, const double frameRate);
    virtual ~EOMFiveDOF() = default;
 
@@ -32,10 +58,46 @@ class EOMFiveDOF : public Module
 
    void computeEOM(const double timestep);
 
+   Integrator getIntegrator() const                          { return integrator; }
+   void setIntegrator(const Integrator x)                    { integrator = x; steps = 0; }
+
+   double getTolerance() const                               { return tolerance;  }
+   void setTolerance(const double x)                         { tolerance = x;     }
+
    friend void xml_bindings::init_EOMFiveDOF(xml::Node*, EOMFiveDOF*);
+   friend class image::Codec;
+   friend class BatchEOMFiveDOF;
 
  private:
-   Quaternion quat;
+   // u, v, w, p, q, r, quaternion (eo, ex, ey, ez), lat, lon, alt, x, y, z
+   using State = std::array<double, 16>;
+
+   // advances the state with any integrator but EULER
+   void integrate(const double timestep);
+   // rates of the state under this frame's forces; 'accel' and 'g' are
+   // the values the player reports
+   void getRates(const State& x, State& dx, Vector3* const accel = nullptr,
+                 double* const g = nullptr);
+   void getState(State& x);
+   void setState(const State& x, const Vector3& accel, const double g);
+
+   void stepRK2(State& x, const State& k1, const double h);
+   void stepRK4(State& x, const State& k1, const double h);
+   void stepAdamsBashforth(State& x, const State& k1, const double h);
+   void stepAdaptive(State& x, const State& k1, const double h);
+
+   Integrator integrator{Integrator::EULER};
+   double tolerance{1e-3};
+
+   // rates of the last frames (ADAMS_BASHFORTH), how many are known and
+   // their timestep
+   State history[2]{};
+   std::size_t steps{};
+   double lastStep{};
+
+   // last substep taken (ADAPTIVE)
+   double substep{};
+
    Quaternion qdot;
    Vector3 forces;
    Vector3 uvw;
@@ -0,0 +1,51 @@
+
+#ifndef __sflight_mdls_EOMSixDOF_HPP__
+#define __sflight_mdls_EOMSixDOF_HPP__
+
+#include "sflight/mdls/modules/Module.hpp"
+
+#include "sflight/xml_bindings/init_EOMSixDOF.hpp"
+
+namespace sflight {
+namespace image {
+class Codec;
+}
+namespace xml {
+class Node;
+}
+namespace mdls {
+class Player;
+
+//------------------------------------------------------------------------------
+// Class: EOMSixDOF
+// Description: Rigid body six DOF dynamics.  The body rates follow from the
+//              aero and propulsion moments through the player's inertia
+//              tensor (Euler's equations, pqrdot = I^-1 (M - pqr x I pqr)),
+//              and sideslip is free, unlike EOMFiveDOF.
+//
+//              pqr and pqrdot are outputs of this module, so modules that set
+//              them directly (StickControl, Autopilot) should not be run with
+//              it; a player without a valid inertia keeps its body rates.
+//              Steps like EOMFiveDOF's Euler integrator.
+//------------------------------------------------------------------------------
+class EOMSixDOF : public Module
+{
+ public:
+   EOMSixDOF(Player*, const double frameRate);
+   virtual ~EOMSixDOF() = default;
+
+   // module interface
+   virtual void update(const double timestep) override;
+
+   void computeEOM(const double timestep);
+
+   friend void xml_bindings::init_EOMSixDOF(xml::Node*, EOMSixDOF*);
+   friend class image::Codec;
+
+ private:
+   double gravConst{};
+};
+}
+}
+
+#endif
@@ -7,6 +7,9 @@
 #include "sflight/xml_bindings/init_Engine.hpp"
 
 namespace sflight {
+namespace image {
+class Codec;
+}
 namespace xml {
 class Node;
 }
@@ -27,6 +30,8 @@ class Engine : public Module
    virtual void update(const double timestep) override;
 
    friend void xml_bindings::init_Engine(xml::Node*, Engine*);
+   friend class image::Codec;
+   friend class BatchEngine;
 
  private:
    double thrustRatio{};
@@ -2,23 +2,39 @@
 #ifndef __sflight_mdls_FileOutput_HPP__
 #define __sflight_mdls_FileOutput_HPP__
 
+#include "sflight/mdls/Telemetry.hpp"
+#include "sflight/mdls/TelemetryWriter.hpp"
 #include "sflight/mdls/modules/Module.hpp"
 
 #include "sflight/xml_bindings/init_FileOutput.hpp"
 
 #include <fstream>
+#include <string>
+#include <vector>
 
 namespace sflight {
+namespace image { class Codec; }
 namespace xml { class Node; }
 namespace mdls {
 class Player;
 
 //------------------------------------------------------------------------------
 // Class: FileOutput
+// Description: Writes the player state to a file, either as text columns or as
+//              a binary telemetry log written by a background thread (see
+//              convertTelemetry() to turn a log into the same columns).  The
+//              file is opened on the first update, so configuring the module
+//              creates no file.
+//
+//              The columns are the chosen channels (Channels::standard() unless
+//              configured), each sampled every 'decimation' output frames; a
+//              text column repeats its last sample in between.
 //------------------------------------------------------------------------------
 class FileOutput : public Module
 {
  public:
+   enum class Format { TEXT, BINARY };
+
    FileOutput() = delete;
    FileOutput(Player*, const double frameRate);
    ~FileOutput();
@@ -26,12 +42,34 @@ class FileOutput : public Module
    // module interface
    virtual void update(const double timestep) override;
 
+   const std::string& getFilename() const                    { return filename; }
+   void setFilename(const std::string& x)                    { filename = x;    }
+
+   Format getFormat() const                                  { return format;   }
+   void setFormat(const Format x)                            { format = x;      }
+
+   const Channels& getChannels() const                       { return channels; }
+   void setChannels(const Channels& x)                       { channels = x;    }
+
    friend void xml_bindings::init_FileOutput(xml::Node*, FileOutput*);
+   friend class image::Codec;
+   friend class BatchFileOutput;
 
  private:
+   void open();
    void update();
 
+   std::string filename;
+   Format format{Format::TEXT};
+   Channels channels{Channels::standard()};
+   bool opened{};
+
+   // values gathered on the current frame, and the last value of each channel
+   std::vector<double> packed;
+   std::vector<double> values;
+
    std::ofstream fout;
+   TelemetryWriter telemetry;
    int rate{};
    double lastTime{};
    int frameCounter{};
@@ -7,6 +7,9 @@
 #include "sflight/xml_bindings/init_InterpAero.hpp"
 
 namespace sflight {
+namespace image {
+class Codec;
+}
 namespace xml {
 class Node;
 }
@@ -16,6 +19,10 @@ class Player;
 //------------------------------------------------------------------------------
 // Class: InterpAero
 // Description: Sets up a simple aero lookup table system
+//
+//              With stability and control derivatives (<Design><Moments>), it
+//              also sets the aero moments, for EOMSixDOF; the pitching moment
+//              is zero at the cruise angle of attack.
 //------------------------------------------------------------------------------
 class InterpAero : public Module
 {
@@ -28,9 +35,11 @@ class InterpAero : public Module
    void createCoefs(const double pitch, const double u, const double vz, const double thrust,
                     double& alpha, double& cl, double& cd);
 
-   double getBetaMach(const double mach) const;
+   static double getBetaMach(const double mach);
 
    friend void xml_bindings::init_InterpAero(xml::Node*, InterpAero*);
+   friend class image::Codec;
+   friend class BatchInterpAero;
 
  private:
    double designWeight{};
@@ -62,6 +71,21 @@ class InterpAero : public Module
    double wingEffects{};
 
    bool usingMachEffects{true};
+
+   // derivatives per radian, over the wing span (roll, yaw) or mean chord
+   // (pitch) in meters, with the body rates made nondimensional by the same
+   // lengths over twice the airspeed; no moments are set without them
+   bool hasMoments{};
+   double chord{};
+   double clBeta{};
+   double clP{};
+   double clAileron{};
+   double cmAlpha{};
+   double cmQ{};
+   double cmElevator{};
+   double cnBeta{};
+   double cnR{};
+   double cnRudder{};
 };
 }
 }
@@ -7,6 +7,9 @@
 #include "sflight/xml_bindings/init_InverseDesign.hpp"
 
 namespace sflight {
+namespace image {
+class Codec;
+}
 namespace xml {
 class Node;
 }
@@ -33,6 +36,8 @@ class InverseDesign : public Module
    double getFuelFlow(double rho, double mach, double thrust);
 
    friend void xml_bindings::init_InverseDesign(xml::Node*, InverseDesign*);
+   friend class image::Codec;
+   friend class BatchInverseDesign;
 
  private:
    double designWeight{};
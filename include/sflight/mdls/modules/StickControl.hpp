@@ -9,6 +9,9 @@
 #include "sflight/xml_bindings/init_StickControl.hpp"
 
 namespace sflight {
+namespace image {
+class Codec;
+}
 namespace xml {
 class Node;
 }
@@ -28,6 +31,8 @@ class StickControl : public Module
    virtual void update(const double timestep) override;
 
    friend void xml_bindings::init_StickControl(xml::Node*, StickControl*);
+   friend class image::Codec;
+   friend class BatchStickControl;
 
  private:
    Vector3 maxRates;
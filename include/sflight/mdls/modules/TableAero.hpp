@@ -4,14 +4,20 @@
 
 #include "sflight/mdls/modules/Module.hpp"
 
+#include "sflight/mdls/TableND.hpp"
+
 #include "sflight/xml_bindings/init_TableAero.hpp"
 
+#include <memory>
+
 namespace sflight {
+namespace image {
+class Codec;
+}
 namespace xml {
 class Node;
 }
 namespace mdls {
-class Table3D;
 class Player;
 
 //------------------------------------------------------------------------------
@@ -21,24 +27,35 @@ class TableAero : public Module
 {
  public:
    TableAero(Player*, const double frameRate);
+   ~TableAero() override;
 
    // module interface
    virtual void update(const double timestep) override;
 
+   // the tables, e.g. to scale them (see TableND::multiply)
+   TableND<3>* getLiftTable() const             { return liftTable.get();     }
+   TableND<3>* getDragTable() const             { return dragTable.get();     }
+   TableND<3>* getThrustTable() const           { return thrustTable.get();   }
+   TableND<3>* getFuelflowTable() const         { return fuelflowTable.get(); }
+
    // void createCoefs( double pitch, double u, double vz, double thrust,
    // double& alpha, double& cl, double& cd );
 
    friend void xml_bindings::init_TableAero(xml::Node*, TableAero*);
+   friend class image::Codec;
+   friend class BatchTableAero;
 
  private:
    double wingSpan{};
    double wingArea{};
    double thrustAngle{};
 
-   Table3D* liftTable{};
-   Table3D* dragTable{};
-   Table3D* thrustTable{};
-   Table3D* fuelflowTable{};
+   // lift and drag: [mach, alt, alpha (or CL)], thrust and fuel flow: [throttle, alt, mach];
+   // shared with the batch modules made from this one
+   std::shared_ptr<TableND<3>> liftTable;
+   std::shared_ptr<TableND<3>> dragTable;
+   std::shared_ptr<TableND<3>> thrustTable;
+   std::shared_ptr<TableND<3>> fuelflowTable;
 
    double a1{};
    double a2{};
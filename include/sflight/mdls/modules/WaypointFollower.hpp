@@ -10,6 +10,7 @@
 #include <vector>
 
 namespace sflight {
+namespace image { class Codec; }
 namespace xml { class Node; }
 namespace mdls {
 class Player;
@@ -49,6 +50,8 @@ class WaypointFollower : public Module
                     const double mpsSpeed, const double radBearing);
 
    friend void xml_bindings::init_WaypointFollower(xml::Node*, WaypointFollower*);
+   friend class image::Codec;
+   friend class BatchWaypointFollower;
 
  private:
    std::vector<Waypoint> waypoints;
@@ -21,6 +21,10 @@ const double radianToMeter{6378137.0 / 2.0 * math::PI};
 bool wgs84LatLon(double* const lat, double* const lon, const double alt, const double vn,
                  const double ve, const double time_diff);
 
+// rates of change of lat and lon (rad/sec) for the given velocities north and east
+bool wgs84LatLonRates(const double lat, const double alt, const double vn, const double ve,
+                      double* const dLat, double* const dLon);
+
 bool simpleLatLon(double* const lat, double* const lon, const double alt, const double vn,
                   const double ve, const double time_diff);
 
@@ -0,0 +1,25 @@
+
+#ifndef __sflight_mdls_simd_HPP__
+#define __sflight_mdls_simd_HPP__
+
+// vectorized kernels are built for 64-bit x86 targets, where SSE2 is always present
+#if defined(__x86_64__) || defined(_M_X64)
+#define SFLIGHT_SIMD_X86
+#endif
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+enum class InstructionSet { SCALAR = 0, SSE2 = 1, AVX2 = 2, AVX512 = 3 };
+
+// returns the widest instruction set supported by both the build and the running cpu
+InstructionSet getInstructionSet();
+
+// returns the name of an instruction set ("scalar", "sse2", "avx2", "avx512")
+const char* toString(const InstructionSet);
+}
+}
+}
+
+#endif
@@ -0,0 +1,52 @@
+
+#ifndef __sflight_xml_Arena_HPP__
+#define __sflight_xml_Arena_HPP__
+
+#include "sflight/xml/StringView.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sflight {
+namespace xml {
+
+//------------------------------------------------------------------------------
+// Class: Arena
+// Description: Hands out memory from large blocks, all freed at once when the
+//              arena is cleared or destroyed.  Objects created in an arena are
+//              never destroyed, so they must not own anything outside it.
+//------------------------------------------------------------------------------
+class Arena
+{
+ public:
+   Arena(const std::size_t blockSize = 64 * 1024) : blockSize(blockSize)                    {}
+   Arena(const Arena&) = delete;
+   Arena& operator=(const Arena&) = delete;
+   ~Arena() = default;
+
+   void* allocate(const std::size_t size, const std::size_t align);
+
+   template <class T, class... Args>
+   T* create(Args&&... args)
+   {
+      return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+   }
+
+   // copies the characters into the arena
+   StringView copy(const StringView&);
+
+   void clear();
+
+ private:
+   std::size_t blockSize{};
+   std::vector<std::unique_ptr<char[]>> blocks;
+   char* next{};
+   char* end{};
+};
+}
+}
+
+#endif
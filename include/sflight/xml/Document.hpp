@@ -0,0 +1,82 @@
+
+#ifndef __sflight_xml_Document_HPP__
+#define __sflight_xml_Document_HPP__
+
+#include "sflight/xml/Arena.hpp"
+#include "sflight/xml/Node.hpp"
+#include "sflight/xml/StringView.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace xml {
+
+//------------------------------------------------------------------------------
+// Class: Document
+// Description: Parses a whole xml file held in memory in a single pass and
+//              builds the same Node tree as parse(), without copying: tag
+//              names, attribute values and text are views into the document's
+//              buffer, and the nodes come from the document's arena.  The
+//              tree lives as long as the document and its root must not be
+//              deleted; nodes created with new and added to it are deleted
+//              with the document.
+//
+//              Each distinct tag name is stored once, so nodes can compare
+//              names by address; looking a name up never allocates.
+//
+//              Like parse(), the text of an element is what comes between its
+//              last tag and its closing tag, without leading whitespace, and
+//              entities are not expanded.
+//------------------------------------------------------------------------------
+class Document
+{
+ public:
+   Document() = default;
+   Document(const Document&) = delete;
+   Document& operator=(const Document&) = delete;
+   ~Document();
+
+   // reads and parses a file; false if it cannot be read or holds no element
+   bool load(const std::string& filename);
+   // parses a copy of the given text
+   bool parse(const std::string& text);
+
+   Node* getRoot() const                                     { return root; }
+
+ private:
+   bool parse();
+
+   void clear();
+
+   Node* addNode(Node* const parent, const StringView& tagName, const StringView& text);
+
+   // the stored copy of a tag name, added if new
+   StringView intern(const StringView&);
+   // the characters of a stored tag name, or null if there is none
+   const char* lookup(const StringView&) const;
+
+   // takes ownership of a node created with new, or gives it back
+   void adopt(Node* const x)                                 { adopted.push_back(x); }
+   void release(Node* const);
+
+   std::unique_ptr<char[]> buffer;
+   std::size_t size{};
+
+   // nodes, indexes and copied strings never move once created
+   Arena arena;
+   Node* root{};
+   std::vector<Node*> adopted;
+
+   // open addressing table of tag names; empty slots have no data
+   std::vector<StringView> names;
+   std::size_t numNames{};
+
+   friend class Node;
+};
+}
+}
+
+#endif
@@ -1,56 +1,119 @@
-
 #ifndef __sflight_xml_Node_HPP__
 #define __sflight_xml_Node_HPP__
 
-#include <map>
+#include "sflight/xml/StringView.hpp"
+
+#include <cstddef>
 #include <string>
 #include <vector>
 
 namespace sflight {
 namespace xml {
+class ChildIndex;
+class Document;
+class Path;
 
 //------------------------------------------------------------------------------
 // Class: Node
+// Description: An xml element.  Attributes are stored as children, with the
+//              attribute value as their text.
+//
+//              Tag names and text are views: into the node's own strings when
+//              set through the constructors or setters, or straight into the
+//              buffer of the Document that parsed them.
+//
+//              Nodes created by a Document live in its arena, with their tag
+//              names interned, and are never deleted on their own.  Children
+//              are found by comparing interned names, through an index kept
+//              up to date as children are added once a node has more than a
+//              few of them; looking up a path allocates nothing and writes
+//              nothing, so a parsed tree can be read from several threads.
+//
+//              The text is read as a number whenever it is set, so getValue()
+//              is a plain read as well.
 //------------------------------------------------------------------------------
 class Node
 {
 public:
    Node() = delete;
-   Node(const std::string& tagName) : tagName(tagName)                                   {}
-   Node(const std::string& name, const std::string& text) : tagName(tagName), text(text) {}
+   Node(const std::string& tagName);
+   Node(const std::string& tagName, const std::string& text);
+   // a node whose tag name and text are kept elsewhere
+   Node(const StringView& tagName, const StringView& text);
    Node(const Node&);
+   Node& operator=(const Node&) = delete;
    virtual ~Node();
 
-   void setTagName(const std::string& x)            { tagName = x;  return; }
-   std::string getTagName() const                   { return tagName;       }
+   void setTagName(const std::string& x);
+   std::string getTagName() const                   { return tagView.str();    }
+   const StringView& getTagView() const             { return tagView;          }
 
    Node* addChild(const std::string&);
    Node* addChild(Node* const);
 
-   std::size_t getChildCount() const;
+   std::size_t getChildCount() const                { return childCount;       }
 
+   // 'tagName' may be a path of tags separated by "/"
    Node* getChild(const std::string& tagName) const;
+   Node* getChild(const StringView& tagName) const;
    Node* getChild(const std::size_t index) const;
 
+   Node* getFirstChild() const                      { return firstChild;       }
+   Node* getNextSibling() const                     { return nextSibling;      }
+
    std::vector<Node*> getChildren(const std::string& childName) const;
 
-   std::string getText() const                      { return text;       }
-   void setText(const std::string& x)               { text = x;          }
+   std::string getText() const                      { return textView.str();   }
+   const StringView& getTextView() const            { return textView;         }
+   void setText(const std::string& x);
+   // the text read as a number (as with atof)
+   double getValue() const                          { return value;            }
 
-   Node* getParent() const                          { return parentNode; }
-   void setParent(Node* const x)                    { parentNode = x;    }
+   Node* getParent() const                          { return parentNode;       }
+   void setParent(Node* const x)                    { parentNode = x;          }
 
    std::string toString() const;
 
    bool remove(Node* const);
 
+   friend class Document;
+   friend class ChildIndex;
+   friend class Path;
+
 private:
-   std::string tagName;
-   std::string text;
-   // vector of pointers to children Nodes
-   std::vector<Node*> childList{};
-   // pointer to parent Node
+   // first child with the given (single) tag name
+   Node* findChild(const StringView& tagName) const;
+   void getChildren(const StringView& path, std::vector<Node*>& list) const;
+   // whether children are looked up through the index
+   bool isIndexed() const;
+   // rebuilds the index, or drops it once no longer used
+   void updateIndex();
+   // reads the text as a number into 'value'
+   void readValue();
+
+   StringView tagView;
+   StringView textView;
+
    Node* parentNode{};
+   Node* firstChild{};
+   Node* lastChild{};
+   Node* nextSibling{};
+   std::size_t childCount{};
+
+   // document the node belongs to, if any
+   Document* document{};
+   // children not created by this node's document (compared by name)
+   bool foreignChildren{};
+
+   // lookup by interned name, maintained by the mutators; next child with the same name
+   ChildIndex* index{};
+   Node* nextSameTag{};
+
+   // the text as a number
+   double value{};
+
+   // tag name and text set through the setters (nodes outside a document)
+   std::string* strings{};
 };
 }
 }
@@ -0,0 +1,38 @@
+
+#ifndef __sflight_xml_Path_HPP__
+#define __sflight_xml_Path_HPP__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace xml {
+class Node;
+
+//------------------------------------------------------------------------------
+// Class: Path
+// Description: A path of tags separated by "/", split once so it can be looked
+//              up under any number of nodes without parsing it again.  Paths
+//              are meant to be built once, e.g. as constants of the bindings,
+//              and used for every player built from a file.
+//------------------------------------------------------------------------------
+class Path
+{
+ public:
+   explicit Path(const std::string& path);
+   explicit Path(const char* path) : Path(std::string(path))                 {}
+
+   // the node at the end of the path below 'parent', or null
+   Node* resolve(Node* const parent) const;
+
+   const std::string& toString() const                       { return path;             }
+
+ private:
+   std::string path;
+   std::vector<std::string> tags;
+};
+}
+}
+
+#endif
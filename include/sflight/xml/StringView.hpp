@@ -0,0 +1,45 @@
+
+#ifndef __sflight_xml_StringView_HPP__
+#define __sflight_xml_StringView_HPP__
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace sflight {
+namespace xml {
+
+//------------------------------------------------------------------------------
+// Class: StringView
+// Description: Characters owned by someone else (a parsed document, or a
+//              node's own string), referenced without copying.  The
+//              characters are not null-terminated.
+//------------------------------------------------------------------------------
+class StringView
+{
+ public:
+   StringView() = default;
+   StringView(const char* data, const std::size_t size) : ptr(data), len(size)       {}
+   StringView(const std::string& x) : ptr(x.data()), len(x.size())                  {}
+
+   const char* data() const                                  { return ptr;              }
+   std::size_t size() const                                  { return len;              }
+   bool empty() const                                        { return len == 0;         }
+   char operator[](const std::size_t i) const                { return ptr[i];           }
+
+   std::string str() const                                   { return std::string(ptr, len); }
+
+   bool operator==(const StringView& x) const
+   {
+      return len == x.len && (len == 0 || std::memcmp(ptr, x.ptr, len) == 0);
+   }
+   bool operator!=(const StringView& x) const                { return !(*this == x);    }
+
+ private:
+   const char* ptr{""};
+   std::size_t len{};
+};
+}
+}
+
+#endif
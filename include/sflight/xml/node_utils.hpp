@@ -3,6 +3,7 @@
 #define __sflight_xml_node_utils_HPP__
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 
 #include <string>
 #include <vector>
@@ -29,6 +30,19 @@ double getDouble(Node* const, const std::string& pathName, const double defaultV
 
 bool getBool(Node* const, const std::string& pathName, const bool defaultVal);
 
+// the same getters for a path split once beforehand; numbers are read once per node
+std::string getString(Node* const, const Path& path, const std::string& defaultVal);
+
+int getInt(Node* const, const Path& path, const int defaultVal);
+
+long getLong(Node* const, const Path& path, const long defaultVal);
+
+float getFloat(Node* const, const Path& path, const float defaultVal);
+
+double getDouble(Node* const, const Path& path, const double defaultVal);
+
+bool getBool(Node* const, const Path& path, const bool defaultVal);
+
 std::vector<std::string> splitString(const std::string& instr, const char splitChar);
 }
 }
@@ -2,12 +2,21 @@
 #ifndef __sflight_xml_bindings_builder_HPP__
 #define __sflight_xml_bindings_builder_HPP__
 
+#include <cstddef>
+
 namespace sflight {
 
 namespace xml  { class Node; }
-namespace mdls { class Player; }
+namespace mdls { class Player; class PlayerBatch; }
 namespace xml_bindings {
 void builder(xml::Node*, mdls::Player*);
+
+// configures a prototype player from the node and adds 'count' copies of it,
+// together with the batch version of each module, to the batch.  A batch holds
+// a single model: false, adding nothing, if a module has no batch version or
+// the node configures modules other than, or differently from, the model the
+// batch was built from
+bool builder(xml::Node*, mdls::PlayerBatch*, const std::size_t count);
 }
 
 }
@@ -0,0 +1,15 @@
+
+#ifndef __init_Atmosphere_HPP__
+#define __init_Atmosphere_HPP__
+
+namespace sflight {
+
+namespace xml  { class Node; }
+namespace mdls { class Atmosphere; }
+namespace xml_bindings {
+void init_Atmosphere(sflight::xml::Node*, sflight::mdls::Atmosphere*);
+}
+
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef __init_EOMSixDOF_HPP__
+#define __init_EOMSixDOF_HPP__
+
+namespace sflight {
+
+namespace xml  { class Node; }
+namespace mdls { class EOMSixDOF; }
+namespace xml_bindings {
+void init_EOMSixDOF(sflight::xml::Node*, sflight::mdls::EOMSixDOF*);
+}
+
+}
+
+#endif
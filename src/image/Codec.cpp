@@ -0,0 +1,572 @@
+
+#include "sflight/image/Codec.hpp"
+
+#include "sflight/image/Reader.hpp"
+#include "sflight/image/Writer.hpp"
+
+#include "sflight/mdls/AutoPilotCmds.hpp"
+#include "sflight/mdls/Inertia.hpp"
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/Quaternion.hpp"
+#include "sflight/mdls/Telemetry.hpp"
+#include "sflight/mdls/Vector3.hpp"
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/mdls/modules/AutoPilot.hpp"
+#include "sflight/mdls/modules/EOMFiveDOF.hpp"
+#include "sflight/mdls/modules/EOMSixDOF.hpp"
+#include "sflight/mdls/modules/Engine.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
+#include "sflight/mdls/modules/InterpAero.hpp"
+#include "sflight/mdls/modules/InverseDesign.hpp"
+#include "sflight/mdls/modules/StickControl.hpp"
+#include "sflight/mdls/modules/TableAero.hpp"
+#include "sflight/mdls/modules/WaypointFollower.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace image {
+
+void Codec::save(Writer& writer, mdls::Player& player) { fields(writer, player); }
+
+void Codec::load(Reader& reader, mdls::Player& player) { fields(reader, player); }
+
+ModuleType Codec::save(Writer& writer, mdls::Module* module)
+{
+   if (auto eom = dynamic_cast<mdls::EOMFiveDOF*>(module)) {
+      fields(writer, *eom);
+      return ModuleType::EOM_FIVE_DOF;
+   } else if (auto eomSixDOF = dynamic_cast<mdls::EOMSixDOF*>(module)) {
+      fields(writer, *eomSixDOF);
+      return ModuleType::EOM_SIX_DOF;
+   } else if (auto interpAero = dynamic_cast<mdls::InterpAero*>(module)) {
+      fields(writer, *interpAero);
+      return ModuleType::INTERP_AERO;
+   } else if (auto tableAero = dynamic_cast<mdls::TableAero*>(module)) {
+      fields(writer, *tableAero);
+      return ModuleType::TABLE_AERO;
+   } else if (auto autoPilot = dynamic_cast<mdls::AutoPilot*>(module)) {
+      fields(writer, *autoPilot);
+      return ModuleType::AUTO_PILOT;
+   } else if (auto engine = dynamic_cast<mdls::Engine*>(module)) {
+      fields(writer, *engine);
+      return ModuleType::ENGINE;
+   } else if (auto atmosphere = dynamic_cast<mdls::Atmosphere*>(module)) {
+      fields(writer, *atmosphere);
+      return ModuleType::ATMOSPHERE;
+   } else if (auto waypointFollower = dynamic_cast<mdls::WaypointFollower*>(module)) {
+      fields(writer, *waypointFollower);
+      return ModuleType::WAYPOINT_FOLLOWER;
+   } else if (auto stickControl = dynamic_cast<mdls::StickControl*>(module)) {
+      fields(writer, *stickControl);
+      return ModuleType::STICK_CONTROL;
+   } else if (auto fileOutput = dynamic_cast<mdls::FileOutput*>(module)) {
+      fields(writer, *fileOutput);
+      return ModuleType::FILE_OUTPUT;
+   } else if (auto inverseDesign = dynamic_cast<mdls::InverseDesign*>(module)) {
+      fields(writer, *inverseDesign);
+      return ModuleType::INVERSE_DESIGN;
+   }
+   return ModuleType::NONE;
+}
+
+mdls::Module* Codec::load(Reader& reader, const ModuleType type, mdls::Player* player)
+{
+   switch (type) {
+   case ModuleType::EOM_FIVE_DOF:       return create<mdls::EOMFiveDOF>(reader, player);
+   case ModuleType::EOM_SIX_DOF:        return create<mdls::EOMSixDOF>(reader, player);
+   case ModuleType::INTERP_AERO:        return create<mdls::InterpAero>(reader, player);
+   case ModuleType::TABLE_AERO:         return create<mdls::TableAero>(reader, player);
+   case ModuleType::AUTO_PILOT:         return create<mdls::AutoPilot>(reader, player);
+   case ModuleType::ENGINE:             return create<mdls::Engine>(reader, player);
+   case ModuleType::ATMOSPHERE:         return create<mdls::Atmosphere>(reader, player);
+   case ModuleType::WAYPOINT_FOLLOWER:  return create<mdls::WaypointFollower>(reader, player);
+   case ModuleType::STICK_CONTROL:      return create<mdls::StickControl>(reader, player);
+   case ModuleType::FILE_OUTPUT:        return create<mdls::FileOutput>(reader, player);
+   case ModuleType::INVERSE_DESIGN:     return create<mdls::InverseDesign>(reader, player);
+   default:                             return nullptr;
+   }
+}
+
+void Codec::saveState(Writer& writer, mdls::Player& player) { state(writer, player); }
+
+void Codec::loadState(Reader& reader, mdls::Player& player) { state(reader, player); }
+
+ModuleType Codec::getType(mdls::Module* module)
+{
+   if (dynamic_cast<mdls::EOMFiveDOF*>(module)) {
+      return ModuleType::EOM_FIVE_DOF;
+   } else if (dynamic_cast<mdls::EOMSixDOF*>(module)) {
+      return ModuleType::EOM_SIX_DOF;
+   } else if (dynamic_cast<mdls::InterpAero*>(module)) {
+      return ModuleType::INTERP_AERO;
+   } else if (dynamic_cast<mdls::TableAero*>(module)) {
+      return ModuleType::TABLE_AERO;
+   } else if (dynamic_cast<mdls::AutoPilot*>(module)) {
+      return ModuleType::AUTO_PILOT;
+   } else if (dynamic_cast<mdls::Engine*>(module)) {
+      return ModuleType::ENGINE;
+   } else if (dynamic_cast<mdls::Atmosphere*>(module)) {
+      return ModuleType::ATMOSPHERE;
+   } else if (dynamic_cast<mdls::WaypointFollower*>(module)) {
+      return ModuleType::WAYPOINT_FOLLOWER;
+   } else if (dynamic_cast<mdls::StickControl*>(module)) {
+      return ModuleType::STICK_CONTROL;
+   } else if (dynamic_cast<mdls::FileOutput*>(module)) {
+      return ModuleType::FILE_OUTPUT;
+   } else if (dynamic_cast<mdls::InverseDesign*>(module)) {
+      return ModuleType::INVERSE_DESIGN;
+   }
+   return ModuleType::NONE;
+}
+
+template <class T>
+mdls::Module* Codec::create(Reader& reader, mdls::Player* player)
+{
+   auto module{new T(player, 0.0)};
+   fields(reader, *module);
+   if (!reader.isGood()) {
+      delete module;
+      return nullptr;
+   }
+   return module;
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Player& x)
+{
+   a.io(x.lat);
+   a.io(x.lon);
+   a.io(x.alt);
+   a.io(x.mass);
+   a.io(x.rho);
+   a.io(x.vInf);
+   a.io(x.mach);
+   a.io(x.alpha);
+   a.io(x.beta);
+   a.io(x.alphaDot);
+   a.io(x.betaDot);
+   a.io(x.altagl);
+   a.io(x.terrainElev);
+   a.io(x.g);
+   fields(a, x.uvw);
+   fields(a, x.uvwdot);
+   fields(a, x.pqr);
+   fields(a, x.pqrdot);
+   // the euler angles follow from the attitude
+   mdls::Quaternion attitude{x.getAttitude()};
+   fields(a, attitude);
+   x.setAttitude(attitude);
+   fields(a, x.thrust);
+   fields(a, x.thrustMoment);
+   fields(a, x.aeroForce);
+   fields(a, x.aeroMoment);
+   fields(a, x.nedVel);
+   fields(a, x.xyz);
+   fields(a, x.deflections);
+   fields(a, x.inertia);
+   fields(a, x.windVel);
+   fields(a, x.windGust);
+   a.io(x.throttle);
+   a.io(x.rpm);
+   a.io(x.fuel);
+   a.io(x.fuelflow);
+   a.io(x.frameNum);
+   a.io(x.simTime);
+   a.io(x.paused);
+   fields(a, x.autoPilotCmds);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Module& x)
+{
+   a.io(x.lastTime);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::AutoPilotCmds& x)
+{
+   a.io(x.vel);
+   a.io(x.alt);
+   a.io(x.vs);
+   a.io(x.hdg);
+   a.io(x.mach);
+   a.io(x.sideslip);
+   a.io(x.apOn);
+   a.io(x.atOn);
+   a.io(x.altHoldOn);
+   a.io(x.vsHoldOn);
+   a.io(x.hdgHoldOn);
+   a.io(x.orbitHoldOn);
+   a.io(x.levelOn);
+   a.io(x.useMach);
+   a.io(x.maxPitch);
+   a.io(x.minPitch);
+   a.io(x.maxBank);
+   a.io(x.maxVS);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Inertia& x)
+{
+   double e[6]{x.getIxx(), x.getIyy(), x.getIzz(), x.getIxy(), x.getIxz(), x.getIyz()};
+   for (std::size_t i = 0; i < 6; i++) {
+      a.io(e[i]);
+   }
+   // the inverse is worked out again
+   x.set(e[0], e[1], e[2], e[3], e[4], e[5]);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Quaternion& x)
+{
+   double e[4]{x.getEo(), x.getEx(), x.getEy(), x.getEz()};
+   for (std::size_t i = 0; i < 4; i++) {
+      a.io(e[i]);
+   }
+   x = mdls::Quaternion(e[0], e[1], e[2], e[3]);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Vector3& x)
+{
+   a.io(x.a1);
+   a.io(x.a2);
+   a.io(x.a3);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::AutoPilot& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.kphi);
+   a.io(x.maxBankRate);
+   a.io(x.kalt);
+   a.io(x.kpitch);
+   a.io(x.maxG);
+   a.io(x.minG);
+   a.io(x.maxG_rate);
+   a.io(x.minG_rate);
+   a.io(x.maxThrottle);
+   a.io(x.minThrottle);
+   a.io(x.spoolTime);
+   a.io(x.lastVz);
+   a.io(x.turnType);
+   a.io(x.hdgErrTol);
+   a.io(x.vsHoldOn);
+   a.io(x.altHoldOn);
+   a.io(x.hdgHoldOn);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Atmosphere& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.model);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::EOMFiveDOF& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   fields(a, x.qdot);
+   fields(a, x.forces);
+   fields(a, x.uvw);
+   fields(a, x.pqr);
+   fields(a, x.xyz);
+   fields(a, x.gravAccel);
+   a.io(x.gravConst);
+   a.io(x.autoRudder);
+   a.io(x.integrator);
+   a.io(x.tolerance);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::EOMSixDOF& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.gravConst);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::Engine& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.thrustRatio);
+   a.io(x.designWeight);
+   a.io(x.thrustAngle);
+   a.io(x.designRho);
+   a.io(x.designTemp);
+   a.io(x.designPress);
+   a.io(x.designMach);
+   a.io(x.designThrust);
+   a.io(x.seaLevelTemp);
+   a.io(x.seaLevelPress);
+   a.io(x.staticThrust);
+   a.io(x.thrustSlope);
+   a.io(x.staticFF);
+   a.io(x.FFslope);
+   a.io(x.thrust);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::FileOutput& x)
+{
+   // the file itself is opened by the module on its first update
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.filename);
+   a.io(x.format);
+   a.io(x.rate);
+   a.io(x.frameCounter);
+
+   // channels are kept by field name, so images do not depend on Player's layout
+   std::uint64_t numChannels{x.channels.size()};
+   a.io(numChannels);
+   std::vector<std::string> names;
+   std::vector<std::uint64_t> decimations;
+   for (std::size_t i = 0; i < x.channels.size(); i++) {
+      names.push_back(x.channels.getField(i).name);
+      decimations.push_back(x.channels.getDecimation(i));
+   }
+   a.resize(names, numChannels);
+   a.resize(decimations, numChannels);
+   mdls::Channels channels;
+   for (std::size_t i = 0; i < names.size(); i++) {
+      a.io(names[i]);
+      a.io(decimations[i]);
+      channels.add(names[i], static_cast<std::size_t>(decimations[i]));
+   }
+   x.channels = channels;
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::InterpAero& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.designWeight);
+   a.io(x.designAlt);
+   a.io(x.wingSpan);
+   a.io(x.wingArea);
+   a.io(x.thrustRatio);
+   a.io(x.thrustAngle);
+   a.io(x.qdes);
+   a.io(x.cruiseAlpha);
+   a.io(x.cruiseCL);
+   a.io(x.cruiseCD);
+   a.io(x.climbAlpha);
+   a.io(x.climbCL);
+   a.io(x.climbCD);
+   a.io(x.a1);
+   a.io(x.a2);
+   a.io(x.b1);
+   a.io(x.b2);
+   a.io(x.cdo);
+   a.io(x.clo);
+   a.io(x.liftSlope);
+   a.io(x.stallCL);
+   a.io(x.wingEffects);
+   a.io(x.usingMachEffects);
+   a.io(x.hasMoments);
+   a.io(x.chord);
+   a.io(x.clBeta);
+   a.io(x.clP);
+   a.io(x.clAileron);
+   a.io(x.cmAlpha);
+   a.io(x.cmQ);
+   a.io(x.cmElevator);
+   a.io(x.cnBeta);
+   a.io(x.cnR);
+   a.io(x.cnRudder);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::InverseDesign& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.designWeight);
+   a.io(x.designAlt);
+   a.io(x.wingSpan);
+   a.io(x.wingArea);
+   a.io(x.staticThrust);
+   a.io(x.staticTSFC);
+   a.io(x.thrustAngle);
+   a.io(x.dTdM);
+   a.io(x.dTdRho);
+   a.io(x.dTSFCdM);
+   a.io(x.qdes);
+   a.io(x.cdo);
+   a.io(x.clo);
+   a.io(x.a);
+   a.io(x.b);
+   a.io(x.usingMachEffects);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::StickControl& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   fields(a, x.maxRates);
+   fields(a, x.maxDef);
+   a.io(x.designQbar);
+   a.io(x.elevGain);
+   a.io(x.rudGain);
+   a.io(x.ailGain);
+   a.io(x.pitchGain);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::TableAero& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.wingSpan);
+   a.io(x.wingArea);
+   a.io(x.thrustAngle);
+   a.io(x.liftTable);
+   a.io(x.dragTable);
+   a.io(x.thrustTable);
+   a.io(x.fuelflowTable);
+   a.io(x.a1);
+   a.io(x.a2);
+   a.io(x.b1);
+   a.io(x.b2);
+   a.io(x.stallCL);
+   a.io(x.wingEffects);
+}
+
+template <class Archive>
+void Codec::fields(Archive& a, mdls::WaypointFollower& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+
+   std::uint64_t numWaypoints{x.waypoints.size()};
+   a.io(numWaypoints);
+   a.resize(x.waypoints, numWaypoints);
+   for (std::size_t i = 0; i < x.waypoints.size(); i++) {
+      a.io(x.waypoints[i].radLat);
+      a.io(x.waypoints[i].radLon);
+      a.io(x.waypoints[i].meterAlt);
+      a.io(x.waypoints[i].mpsSpeed);
+      a.io(x.waypoints[i].radHeading);
+   }
+
+   // the current waypoint is kept as an index into the list (or none)
+   std::uint64_t current{x.currentWp ? std::uint64_t(x.currentWp - x.waypoints.data())
+                                     : x.waypoints.size()};
+   a.io(current);
+   x.currentWp = current < x.waypoints.size() ? &x.waypoints[current] : nullptr;
+
+   a.io(x.wpNum);
+   a.io(x.altTol);
+   a.io(x.distTol);
+   a.io(x.azTol);
+   a.io(x.isOn);
+   a.io(x.cmdPathType);
+}
+template <class Archive>
+void Codec::state(Archive& a, mdls::Player& x)
+{
+   fields(a, x);
+   a.io(x.scheduleFrame);
+   a.io(x.scheduleTime);
+   a.io(x.scheduleTickTime);
+   a.io(x.hasScheduleOrigin);
+
+   std::uint64_t numModules{x.modules.size()};
+   a.io(numModules);
+   a.check(numModules == x.modules.size());
+   for (std::size_t i = 0; i < x.modules.size() && a.isGood(); i++) {
+      const ModuleType expected{getType(x.modules[i])};
+      ModuleType type{expected};
+      a.io(type);
+      a.check(type == expected);
+      state(a, x.modules[i], type);
+   }
+}
+
+template <class Archive>
+void Codec::state(Archive& a, mdls::Module* module, const ModuleType type)
+{
+   switch (type) {
+   case ModuleType::EOM_FIVE_DOF:
+      state(a, *static_cast<mdls::EOMFiveDOF*>(module));
+      break;
+   case ModuleType::AUTO_PILOT:
+      state(a, *static_cast<mdls::AutoPilot*>(module));
+      break;
+   case ModuleType::ENGINE:
+      state(a, *static_cast<mdls::Engine*>(module));
+      break;
+   case ModuleType::WAYPOINT_FOLLOWER:
+      state(a, *static_cast<mdls::WaypointFollower*>(module));
+      break;
+   case ModuleType::FILE_OUTPUT:
+      state(a, *static_cast<mdls::FileOutput*>(module));
+      break;
+   default:
+      // the others hold only their configuration
+      fields(a, *module);
+      break;
+   }
+}
+
+template <class Archive>
+void Codec::state(Archive& a, mdls::AutoPilot& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.lastVz);
+   a.io(x.vsHoldOn);
+   a.io(x.altHoldOn);
+   a.io(x.hdgHoldOn);
+}
+
+template <class Archive>
+void Codec::state(Archive& a, mdls::EOMFiveDOF& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   for (std::size_t i = 0; i < 2; i++) {
+      for (std::size_t j = 0; j < x.history[i].size(); j++) {
+         a.io(x.history[i][j]);
+      }
+   }
+   a.io(x.steps);
+   a.io(x.lastStep);
+   a.io(x.substep);
+   fields(a, x.qdot);
+   fields(a, x.forces);
+   fields(a, x.uvw);
+   fields(a, x.pqr);
+   fields(a, x.xyz);
+   fields(a, x.gravAccel);
+}
+
+template <class Archive>
+void Codec::state(Archive& a, mdls::Engine& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.thrust);
+}
+
+template <class Archive>
+void Codec::state(Archive& a, mdls::FileOutput& x)
+{
+   // where the output goes next; what it has written stays in its file
+   fields(a, static_cast<mdls::Module&>(x));
+   a.io(x.lastTime);
+   a.io(x.frameCounter);
+}
+
+template <class Archive>
+void Codec::state(Archive& a, mdls::WaypointFollower& x)
+{
+   fields(a, static_cast<mdls::Module&>(x));
+   std::uint64_t current{x.currentWp ? std::uint64_t(x.currentWp - x.waypoints.data())
+                                     : x.waypoints.size()};
+   a.io(current);
+   x.currentWp = current < x.waypoints.size() ? &x.waypoints[current] : nullptr;
+   a.io(x.wpNum);
+   a.io(x.isOn);
+}
+}
+}
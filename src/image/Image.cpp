@@ -0,0 +1,134 @@
+
+#include "sflight/image/Image.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sflight {
+namespace image {
+
+namespace {
+
+// true if the 'size' bytes at 'offset' lie within an image of 'total' bytes
+bool contains(const std::uint64_t total, const std::uint64_t offset, const std::uint64_t size)
+{
+   return offset <= total && size <= total - offset;
+}
+}
+
+Image::~Image() { close(); }
+
+bool Image::open(const std::string& filename)
+{
+   close();
+
+#if defined(_WIN32)
+   std::ifstream fin(filename, std::ifstream::binary | std::ifstream::ate);
+   if (!fin) {
+      std::cout << "Could not open model image : " << filename << std::endl;
+      return false;
+   }
+   size = static_cast<std::size_t>(fin.tellg());
+   fin.seekg(0);
+
+   // values in the image are aligned to 64 bytes from its start
+   const std::size_t pad{64 / sizeof(double)};
+   buffer.reset(new double[size / sizeof(double) + 1 + pad]);
+   const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(buffer.get())};
+   data = reinterpret_cast<char*>(buffer.get() + ((64 - address % 64) % 64) / sizeof(double));
+   if (!fin.read(data, size)) {
+      std::cout << "Could not read model image : " << filename << std::endl;
+      close();
+      return false;
+   }
+#else
+   const int fd{::open(filename.c_str(), O_RDONLY)};
+   if (fd < 0) {
+      std::cout << "Could not open model image : " << filename << std::endl;
+      return false;
+   }
+   struct stat info;
+   if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+      std::cout << "Could not read model image : " << filename << std::endl;
+      ::close(fd);
+      return false;
+   }
+   size = static_cast<std::size_t>(info.st_size);
+
+   // read only: a table copies its values before changing them (see GridTable)
+   void* address{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+   ::close(fd);
+   if (address == MAP_FAILED) {
+      std::cout << "Could not map model image : " << filename << std::endl;
+      size = 0;
+      return false;
+   }
+   data = static_cast<char*>(address);
+#endif
+
+   if (!check()) {
+      std::cout << "Not a valid model image : " << filename << std::endl;
+      close();
+      return false;
+   }
+   std::cout << "Opened model image : " << filename << std::endl;
+   return true;
+}
+
+void Image::close()
+{
+#if !defined(_WIN32)
+   if (data != nullptr && !buffer) {
+      ::munmap(data, size);
+   }
+#endif
+   buffer.reset();
+   data = nullptr;
+   size = 0;
+   header = Header();
+}
+
+bool Image::check()
+{
+   if (size < sizeof(Header)) {
+      return false;
+   }
+   std::memcpy(&header, data, sizeof(Header));
+
+   if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version ||
+       header.byteOrder != byteOrder || header.size != size) {
+      return false;
+   }
+   if (!contains(size, header.playerOffset, header.playerSize) ||
+       header.numModules > size / sizeof(ModuleEntry) ||
+       !contains(size, header.modulesOffset, header.numModules * sizeof(ModuleEntry))) {
+      return false;
+   }
+
+   for (std::uint64_t i = 0; i < header.numModules; i++) {
+      ModuleEntry entry;
+      std::memcpy(&entry, data + header.modulesOffset + i * sizeof(ModuleEntry), sizeof(entry));
+      if (!contains(size, entry.offset, entry.size)) {
+         return false;
+      }
+   }
+   return true;
+}
+
+bool Image::isImage(const std::string& filename)
+{
+   std::ifstream fin(filename, std::ifstream::binary);
+   char start[sizeof(magic)]{};
+   return fin.read(start, sizeof(start)) && std::memcmp(start, magic, sizeof(magic)) == 0;
+}
+}
+}
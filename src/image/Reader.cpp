@@ -0,0 +1,60 @@
+
+#include "sflight/image/Reader.hpp"
+
+#include <cstring>
+
+namespace sflight {
+namespace image {
+
+Reader::Reader(char* data, const std::uint64_t offset, const std::uint64_t size)
+    : data(data), pos(offset), end(offset + size)
+{
+}
+
+char* Reader::read(const std::size_t size)
+{
+   if (!good || size > end - pos) {
+      good = false;
+      return nullptr;
+   }
+   char* x{data + pos};
+   pos += size;
+   return x;
+}
+
+void Reader::get(void* x, const std::size_t size)
+{
+   const char* bytes{read(size)};
+   if (bytes) {
+      std::memcpy(x, bytes, size);
+   }
+}
+
+void Reader::io(bool& x)
+{
+   std::uint64_t value{x};
+   io(value);
+   x = value != 0;
+}
+
+void Reader::io(int& x)
+{
+   std::int64_t value{x};
+   io(value);
+   x = static_cast<int>(value);
+}
+
+void Reader::io(std::string& x)
+{
+   std::uint64_t size{};
+   io(size);
+   const std::uint64_t padded{(size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t) *
+                              sizeof(std::uint64_t)};
+   if (!good || size > padded || padded > end - pos) {
+      good = false;
+      return;
+   }
+   x.assign(read(padded), size);
+}
+}
+}
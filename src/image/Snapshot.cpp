@@ -0,0 +1,29 @@
+
+#include "sflight/image/Snapshot.hpp"
+
+#include "sflight/image/Codec.hpp"
+#include "sflight/image/Reader.hpp"
+
+#include "sflight/mdls/Player.hpp"
+
+namespace sflight {
+namespace image {
+
+void Snapshot::save(mdls::Player& player)
+{
+   writer.clear();
+   Codec::saveState(writer, player);
+}
+
+bool Snapshot::restore(mdls::Player& player) const
+{
+   if (isEmpty()) {
+      return false;
+   }
+   // a state holds no tables, so nothing is ever pointed at or written through
+   Reader reader(const_cast<char*>(getData()), 0, getSize());
+   Codec::loadState(reader, player);
+   return reader.isGood() && reader.isEnd();
+}
+}
+}
@@ -0,0 +1,32 @@
+
+#include "sflight/image/Writer.hpp"
+
+#include <cstring>
+
+namespace sflight {
+namespace image {
+
+void Writer::align(const std::size_t bytes)
+{
+   buffer.resize((buffer.size() + bytes - 1) / bytes * bytes, 0);
+}
+
+void Writer::write(const void* data, const std::size_t size)
+{
+   const char* bytes{static_cast<const char*>(data)};
+   buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void Writer::patch(const std::uint64_t offset, const void* data, const std::size_t size)
+{
+   std::memcpy(&buffer[offset], data, size);
+}
+
+void Writer::io(const std::string& x)
+{
+   io(std::uint64_t(x.size()));
+   write(x.data(), x.size());
+   align(sizeof(std::uint64_t));
+}
+}
+}
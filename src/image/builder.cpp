@@ -0,0 +1,51 @@
+
+#include "sflight/image/builder.hpp"
+
+#include "sflight/image/Codec.hpp"
+#include "sflight/image/Image.hpp"
+#include "sflight/image/Reader.hpp"
+
+#include "sflight/mdls/Pipeline.hpp"
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/Module.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace sflight {
+namespace image {
+
+bool builder(const Image& image, mdls::Player* player)
+{
+   if (!image.isOpen()) {
+      return false;
+   }
+   const Header& header{image.getHeader()};
+
+   Reader reader(image.getData(), header.playerOffset, header.playerSize);
+   Codec::load(reader, *player);
+   if (!reader.isGood()) {
+      std::cout << "Model image: player could not be loaded" << std::endl;
+      return false;
+   }
+
+   for (std::uint64_t i = 0; i < header.numModules; i++) {
+      ModuleEntry entry;
+      std::memcpy(&entry, image.getData() + header.modulesOffset + i * sizeof(ModuleEntry),
+                  sizeof(entry));
+
+      Reader moduleReader(image.getData(), entry.offset, entry.size);
+      mdls::Module* module{Codec::load(moduleReader, entry.type, player)};
+      if (module == nullptr) {
+         std::cout << "Model image: module " << i << " could not be loaded" << std::endl;
+         return false;
+      }
+      module->frameTime = entry.frameTime;
+      player->addModule(module);
+   }
+   mdls::selectPipeline(player);
+   return true;
+}
+}
+}
@@ -0,0 +1,69 @@
+
+#include "sflight/image/compile.hpp"
+
+#include "sflight/image/Codec.hpp"
+#include "sflight/image/Writer.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/Module.hpp"
+#include "sflight/xml_bindings/builder.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace sflight {
+namespace image {
+
+bool compile(xml::Node* node, const std::string& filename)
+{
+   mdls::Player prototype;
+   xml_bindings::builder(node, &prototype);
+
+   Writer writer;
+
+   // written again once all offsets are known
+   Header header;
+   std::memcpy(header.magic, magic, sizeof(magic));
+   header.version = version;
+   header.byteOrder = byteOrder;
+   writer.write(&header, sizeof(header));
+
+   header.playerOffset = writer.tell();
+   Codec::save(writer, prototype);
+   header.playerSize = writer.tell() - header.playerOffset;
+
+   std::vector<ModuleEntry> entries;
+   for (std::size_t i = 0; i < prototype.modules.size(); i++) {
+      ModuleEntry entry;
+      entry.offset = writer.tell();
+      entry.type = Codec::save(writer, prototype.modules[i]);
+      entry.size = writer.tell() - entry.offset;
+      entry.frameTime = prototype.modules[i]->frameTime;
+      if (entry.type == ModuleType::NONE) {
+         std::cout << "Module " << i << " has no image form, skipped" << std::endl;
+         continue;
+      }
+      entries.push_back(entry);
+   }
+
+   header.modulesOffset = writer.tell();
+   header.numModules = entries.size();
+   writer.write(entries.data(), entries.size() * sizeof(ModuleEntry));
+
+   header.size = writer.tell();
+   writer.patch(0, &header, sizeof(header));
+
+   std::ofstream fout(filename, std::ofstream::binary);
+   const std::vector<char>& buffer{writer.getBuffer()};
+   if (!fout.write(buffer.data(), buffer.size())) {
+      std::cout << "Could not write model image : " << filename << std::endl;
+      return false;
+   }
+   std::cout << "Wrote model image : " << filename << " (" << buffer.size() << " bytes)"
+             << std::endl;
+   return true;
+}
+}
+}
@@ -0,0 +1,33 @@
+
+#include "sflight/image/fingerprint.hpp"
+
+#include "sflight/image/Codec.hpp"
+#include "sflight/image/Writer.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/Module.hpp"
+
+#include <vector>
+
+namespace sflight {
+namespace image {
+
+std::uint64_t fingerprint(mdls::Player& player)
+{
+   Writer writer;
+   Codec::save(writer, player);
+   for (std::size_t i = 0; i < player.modules.size(); i++) {
+      writer.io(Codec::save(writer, player.modules[i]));
+   }
+   Codec::saveState(writer, player);
+
+   std::uint64_t hash{0xcbf29ce484222325};
+   const std::vector<char>& buffer{writer.getBuffer()};
+   for (std::size_t i = 0; i < buffer.size(); i++) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 0x100000001b3;
+   }
+   return hash;
+}
+}
+}
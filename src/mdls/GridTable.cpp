@@ -0,0 +1,274 @@
+
+#include "sflight/mdls/GridTable.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+namespace sflight {
+namespace mdls {
+
+GridTable::GridTable(const std::vector<std::vector<double>>& breakpoints, const Layout layout)
+    : rank(breakpoints.size()), layout(layout)
+{
+   checkRank();
+
+   std::size_t numVals[maxRank]{};
+   std::size_t totalVals{};
+   for (std::size_t i = 0; i < rank; i++) {
+      numVals[i] = breakpoints[i].size() > 0 ? breakpoints[i].size() : 1;
+      totalVals += numVals[i];
+   }
+   setup(numVals);
+
+   // values first, aligned to 64 bytes, then the breakpoints of each axis
+   const std::size_t pad{64 / sizeof(double)};
+   storage.reset(new double[dataSize + totalVals + pad]());
+   const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(storage.get())};
+   data = storage.get() + ((64 - address % 64) % 64) / sizeof(double);
+
+   double* next{data + dataSize};
+   for (std::size_t i = 0; i < rank; i++) {
+      for (std::size_t j = 0; j < breakpoints[i].size(); j++) {
+         next[j] = breakpoints[i][j];
+      }
+      vals[i] = next;
+      axes[i] = TableAxis(next, numVals[i]);
+      next += numVals[i];
+   }
+}
+
+GridTable::GridTable(const std::vector<std::size_t>& numVals, const double* breakpoints,
+                     double* values, const Layout layout)
+    : rank(numVals.size()), layout(layout), data(values)
+{
+   checkRank();
+
+   std::size_t n[maxRank]{};
+   const double* next{breakpoints};
+   for (std::size_t i = 0; i < rank; i++) {
+      n[i] = numVals[i] > 0 ? numVals[i] : 1;
+      vals[i] = next;
+      axes[i] = TableAxis(next, n[i]);
+      next += n[i];
+   }
+   setup(n);
+}
+
+std::size_t GridTable::getDataSize(const std::vector<std::size_t>& numVals, const Layout layout)
+{
+   const std::size_t numCorners{std::size_t(1) << numVals.size()};
+   std::size_t numPoints{1};
+   std::size_t numCells{1};
+   for (std::size_t i = 0; i < numVals.size(); i++) {
+      const std::size_t n{numVals[i] > 0 ? numVals[i] : 1};
+      numPoints *= n;
+      numCells *= n > 1 ? n - 1 : 1;
+   }
+   return layout == Layout::CELL ? numCells * numCorners : numPoints;
+}
+
+void GridTable::checkRank() const
+{
+   if (rank == 0 || rank > maxRank) {
+      std::cout << "GridTable rank must be between 1 and " << maxRank << std::endl;
+      std::exit(0);
+   }
+}
+
+void GridTable::setup(const std::size_t numVals[])
+{
+   numCorners = std::size_t(1) << rank;
+
+   std::size_t numPoints{1};
+   std::size_t numCells{1};
+   for (std::size_t i = 0; i < rank; i++) {
+      cells[i] = numVals[i] > 1 ? numVals[i] - 1 : 1;
+      numPoints *= numVals[i];
+      numCells *= cells[i];
+   }
+   dataSize = layout == Layout::CELL ? numCells * numCorners : numPoints;
+
+   std::size_t stride{1};
+   for (std::size_t i = rank; i-- > 0;) {
+      strides[i] = stride;
+      stride *= layout == Layout::CELL ? cells[i] : numVals[i];
+   }
+}
+
+void GridTable::setData(const std::vector<double>& values)
+{
+   std::size_t numPoints{1};
+   for (std::size_t i = 0; i < rank; i++) {
+      numPoints *= axes[i].size();
+   }
+   if (values.size() != numPoints) {
+      return;
+   }
+
+   std::size_t index[maxRank]{};
+   for (std::size_t k = 0; k < numPoints; k++) {
+      set(index, values[k]);
+      // next index in row-major order
+      for (std::size_t i = rank; i-- > 0;) {
+         if (++index[i] < axes[i].size()) {
+            break;
+         }
+         index[i] = 0;
+      }
+   }
+}
+
+void GridTable::set(const std::size_t index[], const double val)
+{
+   copyData();
+   if (layout == Layout::ROW_MAJOR) {
+      std::size_t offset{};
+      for (std::size_t i = 0; i < rank; i++) {
+         offset += index[i] * strides[i];
+      }
+      data[offset] = val;
+      return;
+   }
+
+   // a value is a corner of up to 2^rank cells
+   for (std::size_t c = 0; c < numCorners; c++) {
+      std::size_t cell{};
+      bool inside{true};
+      for (std::size_t i = 0; i < rank && inside; i++) {
+         const std::size_t high{(c >> (rank - 1 - i)) & 1};
+         if (axes[i].size() == 1) {
+            continue;
+         }
+         inside = index[i] >= high && index[i] - high < cells[i];
+         cell += (index[i] - high) * strides[i];
+      }
+      if (inside) {
+         data[cell * numCorners + c] = val;
+      }
+   }
+}
+
+double GridTable::get(const std::size_t index[]) const
+{
+   std::size_t offset{};
+   std::size_t corner{};
+   for (std::size_t i = 0; i < rank; i++) {
+      if (layout == Layout::ROW_MAJOR) {
+         offset += index[i] * strides[i];
+      } else {
+         // use the cell below, except on the last breakpoint
+         const std::size_t high{static_cast<std::size_t>(axes[i].size() > 1 && index[i] == cells[i])};
+         offset += (index[i] - high) * strides[i];
+         corner |= high << (rank - 1 - i);
+      }
+   }
+   return layout == Layout::CELL ? data[offset * numCorners + corner] : data[offset];
+}
+
+const double* GridTable::getCorners(const std::size_t low[]) const
+{
+   std::size_t cell{};
+   for (std::size_t i = 0; i < rank; i++) {
+      cell += low[i] * strides[i];
+   }
+   return data + cell * numCorners;
+}
+
+void GridTable::multiply(const double val)
+{
+   copyData();
+   for (std::size_t i = 0; i < dataSize; i++) {
+      data[i] = data[i] * val;
+   }
+}
+
+double GridTable::interp(const double x[])
+{
+   std::size_t low[maxRank];
+   double weight[maxRank];
+   for (std::size_t i = 0; i < rank; i++) {
+      low[i] = axes[i].find(x[i]);
+      weight[i] = axes[i].getWeight(low[i], x[i]);
+   }
+
+   // corner values; bit (rank - 1 - i) of the corner selects the high side of axis i
+   double v[std::size_t(1) << maxRank];
+   if (layout == Layout::CELL) {
+      const double* corners{getCorners(low)};
+      for (std::size_t c = 0; c < numCorners; c++) {
+         v[c] = corners[c];
+      }
+   } else {
+      for (std::size_t c = 0; c < numCorners; c++) {
+         std::size_t offset{};
+         for (std::size_t i = 0; i < rank; i++) {
+            const std::size_t high{(c >> (rank - 1 - i)) & 1};
+            offset += (low[i] + (axes[i].size() > 1 ? high : 0)) * strides[i];
+         }
+         v[c] = data[offset];
+      }
+   }
+
+   // collapse one axis at a time, last axis first
+   std::size_t n{numCorners};
+   for (std::size_t i = rank; i-- > 0;) {
+      n /= 2;
+      for (std::size_t j = 0; j < n; j++) {
+         v[j] = v[2 * j] + (v[2 * j + 1] - v[2 * j]) * weight[i];
+      }
+   }
+   return v[0];
+}
+
+void GridTable::print() const
+{
+   for (std::size_t i = 0; i < rank; i++) {
+      std::cout << "axis " << i << " vals: [";
+      for (std::size_t j = 0; j < axes[i].size(); j++) {
+         std::cout << vals[i][j] << ", ";
+      }
+      std::cout << "]" << std::endl;
+   }
+
+   std::size_t numPoints{1};
+   for (std::size_t i = 0; i < rank; i++) {
+      numPoints *= axes[i].size();
+   }
+   const std::size_t numCols{axes[rank - 1].size()};
+
+   std::size_t index[maxRank]{};
+   for (std::size_t k = 0; k < numPoints; k++) {
+      if (index[rank - 1] == 0) {
+         std::cout << "[ ";
+      }
+      std::cout << get(index) << ", ";
+      if (index[rank - 1] == numCols - 1) {
+         std::cout << "]" << std::endl;
+      }
+      for (std::size_t i = rank; i-- > 0;) {
+         if (++index[i] < axes[i].size()) {
+            break;
+         }
+         index[i] = 0;
+      }
+   }
+}
+
+void GridTable::copyData()
+{
+   if (storage != nullptr) {
+      return;
+   }
+   // values over external memory, aligned as in a table of our own; the
+   // breakpoints are never written, so they stay where they are
+   const std::size_t pad{64 / sizeof(double)};
+   storage.reset(new double[dataSize + pad]);
+   const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(storage.get())};
+   double* const values{storage.get() + ((64 - address % 64) % 64) / sizeof(double)};
+   std::copy(data, data + dataSize, values);
+   data = values;
+}
+}
+}
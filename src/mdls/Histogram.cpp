@@ -0,0 +1,94 @@
+
+#include "sflight/mdls/Histogram.hpp"
+
+namespace sflight {
+namespace mdls {
+
+std::size_t Histogram::getBucket(const std::uint64_t x)
+{
+   const std::uint64_t linear{std::uint64_t(1) << subBits};
+   if (x < linear) {
+      return static_cast<std::size_t>(x);
+   }
+   // position of the highest bit set
+   std::size_t e{};
+   for (std::size_t step = 32; step > 0; step /= 2) {
+      if (x >> (e + step)) {
+         e += step;
+      }
+   }
+   const std::size_t shift{e - subBits};
+   return ((shift + 1) << subBits) + static_cast<std::size_t>((x >> shift) - linear);
+}
+
+std::uint64_t Histogram::getBucketLow(const std::size_t bucket)
+{
+   const std::size_t linear{std::size_t(1) << subBits};
+   if (bucket < linear) {
+      return bucket;
+   }
+   const std::size_t shift{(bucket >> subBits) - 1};
+   return (static_cast<std::uint64_t>(linear + (bucket & (linear - 1)))) << shift;
+}
+
+void Histogram::record(const std::uint64_t x)
+{
+   buckets[getBucket(x)]++;
+   if (count == 0 || x < min) {
+      min = x;
+   }
+   if (x > max) {
+      max = x;
+   }
+   count++;
+   sum += static_cast<double>(x);
+}
+
+void Histogram::clear()
+{
+   buckets.fill(0);
+   count = 0;
+   min = 0;
+   max = 0;
+   sum = 0;
+}
+
+void Histogram::add(const Histogram& x)
+{
+   if (x.count == 0) {
+      return;
+   }
+   for (std::size_t i = 0; i < numBuckets; i++) {
+      buckets[i] += x.buckets[i];
+   }
+   if (count == 0 || x.min < min) {
+      min = x.min;
+   }
+   if (x.max > max) {
+      max = x.max;
+   }
+   count += x.count;
+   sum += x.sum;
+}
+
+double Histogram::getMean() const { return count > 0 ? sum / static_cast<double>(count) : 0; }
+
+std::uint64_t Histogram::getPercentile(const double fraction) const
+{
+   if (count == 0) {
+      return 0;
+   }
+   const double target{fraction * static_cast<double>(count)};
+   std::uint64_t seen{};
+   for (std::size_t i = 0; i < numBuckets; i++) {
+      seen += buckets[i];
+      if (seen > 0 && static_cast<double>(seen) >= target) {
+         // the bucket's upper end, but never past the largest value
+         const std::uint64_t high{i + 1 < numBuckets ? getBucketLow(i + 1) - 1 : max};
+         return high < max ? (high > min ? high : min) : max;
+      }
+   }
+   return max;
+}
+}
+}
@@ -0,0 +1,52 @@
+
+#include "sflight/mdls/Inertia.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+namespace sflight {
+namespace mdls {
+
+Inertia::Inertia(const double ixx, const double iyy, const double izz, const double ixy,
+                 const double ixz, const double iyz)
+{
+   set(ixx, iyy, izz, ixy, ixz, iyz);
+}
+
+bool Inertia::set(const double ixx, const double iyy, const double izz, const double ixy,
+                  const double ixz, const double iyz)
+{
+   tensor[0][0] = ixx;
+   tensor[1][1] = iyy;
+   tensor[2][2] = izz;
+   tensor[0][1] = tensor[1][0] = -ixy;
+   tensor[0][2] = tensor[2][0] = -ixz;
+   tensor[1][2] = tensor[2][1] = -iyz;
+
+   // inverse by cofactors (the tensor is symmetric, and so is its inverse)
+   const double c00{tensor[1][1] * tensor[2][2] - tensor[1][2] * tensor[2][1]};
+   const double c01{tensor[1][2] * tensor[2][0] - tensor[1][0] * tensor[2][2]};
+   const double c02{tensor[1][0] * tensor[2][1] - tensor[1][1] * tensor[2][0]};
+   const double det{tensor[0][0] * c00 + tensor[0][1] * c01 + tensor[0][2] * c02};
+
+   const double scale{std::abs(ixx) + std::abs(iyy) + std::abs(izz)};
+   valid = scale > 0 && std::abs(det) > 1e-12 * scale * scale * scale;
+   if (!valid) {
+      for (std::size_t i = 0; i < 3; i++) {
+         for (std::size_t j = 0; j < 3; j++) {
+            inverse[i][j] = 0;
+         }
+      }
+      return false;
+   }
+
+   inverse[0][0] = c00 / det;
+   inverse[0][1] = inverse[1][0] = c01 / det;
+   inverse[0][2] = inverse[2][0] = c02 / det;
+   inverse[1][1] = (tensor[0][0] * tensor[2][2] - tensor[0][2] * tensor[2][0]) / det;
+   inverse[1][2] = inverse[2][1] = (tensor[0][2] * tensor[1][0] - tensor[0][0] * tensor[1][2]) / det;
+   inverse[2][2] = (tensor[0][0] * tensor[1][1] - tensor[0][1] * tensor[1][0]) / det;
+   return true;
+}
+}
+}
@@ -0,0 +1,296 @@
+
+#include "sflight/mdls/InputLog.hpp"
+
+#include "sflight/mdls/Player.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace sflight {
+namespace mdls {
+
+namespace {
+std::uint64_t toBits(const double x)
+{
+   std::uint64_t bits{};
+   std::memcpy(&bits, &x, sizeof(bits));
+   return bits;
+}
+
+double fromBits(const std::uint64_t bits)
+{
+   double x{};
+   std::memcpy(&x, &bits, sizeof(x));
+   return x;
+}
+
+// the XOR of two values is written bit reversed, so that the trailing zeros
+// of round values cost nothing
+std::uint64_t reverseBits(std::uint64_t x)
+{
+   x = ((x >> 1) & 0x5555555555555555) | ((x & 0x5555555555555555) << 1);
+   x = ((x >> 2) & 0x3333333333333333) | ((x & 0x3333333333333333) << 2);
+   x = ((x >> 4) & 0x0f0f0f0f0f0f0f0f) | ((x & 0x0f0f0f0f0f0f0f0f) << 4);
+   x = ((x >> 8) & 0x00ff00ff00ff00ff) | ((x & 0x00ff00ff00ff00ff) << 8);
+   x = ((x >> 16) & 0x0000ffff0000ffff) | ((x & 0x0000ffff0000ffff) << 16);
+   return (x >> 32) | (x << 32);
+}
+
+void getBits(const Player& player, std::uint64_t bits[Inputs::size])
+{
+   double x[Inputs::size]{};
+   Inputs::get(player, x);
+   for (std::size_t i = 0; i < Inputs::size; i++) {
+      bits[i] = toBits(x[i]);
+   }
+}
+}
+
+void Inputs::get(const Player& player, double x[size])
+{
+   const AutoPilotCmds& cmds{player.autoPilotCmds};
+   const double values[size]{
+       player.deflections.a1, player.deflections.a2, player.deflections.a3, player.throttle,
+       cmds.vel,       cmds.alt,       cmds.vs,        cmds.hdg,
+       cmds.mach,      cmds.sideslip,  cmds.maxPitch,  cmds.minPitch,
+       cmds.maxBank,   cmds.maxVS,
+       static_cast<double>(cmds.apOn),      static_cast<double>(cmds.atOn),
+       static_cast<double>(cmds.altHoldOn), static_cast<double>(cmds.vsHoldOn),
+       static_cast<double>(cmds.hdgHoldOn), static_cast<double>(cmds.orbitHoldOn),
+       static_cast<double>(cmds.levelOn),   static_cast<double>(cmds.useMach)};
+   std::memcpy(x, values, sizeof(values));
+}
+
+void Inputs::set(Player& player, const std::size_t index, const double x)
+{
+   AutoPilotCmds& cmds{player.autoPilotCmds};
+   switch (index) {
+      case 0:  player.deflections.a1 = x; break;
+      case 1:  player.deflections.a2 = x; break;
+      case 2:  player.deflections.a3 = x; break;
+      case 3:  player.throttle = x;       break;
+      case 4:  cmds.vel = x;              break;
+      case 5:  cmds.alt = x;              break;
+      case 6:  cmds.vs = x;               break;
+      case 7:  cmds.hdg = x;              break;
+      case 8:  cmds.mach = x;             break;
+      case 9:  cmds.sideslip = x;         break;
+      case 10: cmds.maxPitch = x;         break;
+      case 11: cmds.minPitch = x;         break;
+      case 12: cmds.maxBank = x;          break;
+      case 13: cmds.maxVS = x;            break;
+      case 14: cmds.apOn = x != 0;        break;
+      case 15: cmds.atOn = x != 0;        break;
+      case 16: cmds.altHoldOn = x != 0;   break;
+      case 17: cmds.vsHoldOn = x != 0;    break;
+      case 18: cmds.hdgHoldOn = x != 0;   break;
+      case 19: cmds.orbitHoldOn = x != 0; break;
+      case 20: cmds.levelOn = x != 0;     break;
+      case 21: cmds.useMach = x != 0;     break;
+      default: break;
+   }
+}
+
+InputRecorder::~InputRecorder() { close(); }
+
+bool InputRecorder::open(const std::string& filename, const Player& player,
+                         const double frameTime, const std::uint64_t modelHash)
+{
+   close();
+   file = std::fopen(filename.c_str(), "wb");
+   if (file == nullptr) {
+      std::cout << "Could not open input log : " << filename << std::endl;
+      return false;
+   }
+
+   InputLogHeader header;
+   std::memcpy(header.magic, inputlog::magic, sizeof(header.magic));
+   header.version = inputlog::version;
+   header.byteOrder = inputlog::byteOrder;
+   header.numInputs = static_cast<std::uint32_t>(Inputs::size);
+   header.startFrame = player.frameNum;
+   header.frameTime = frameTime;
+   header.modelHash = modelHash;
+   std::fwrite(&header, sizeof(header), 1, file);
+
+   // the first record holds every input that is not zero
+   lastFrame = frame = player.frameNum;
+   std::memset(settled, 0, sizeof(settled));
+   return true;
+}
+
+void InputRecorder::close()
+{
+   if (file == nullptr) {
+      return;
+   }
+   write(frame - lastFrame);
+   write(0);
+   std::fclose(file);
+   file = nullptr;
+}
+
+void InputRecorder::update(Player& player, const double timestep)
+{
+   if (file != nullptr) {
+      std::uint64_t bits[Inputs::size]{};
+      getBits(player, bits);
+      std::uint64_t mask{};
+      for (std::size_t i = 0; i < Inputs::size; i++) {
+         if (bits[i] != settled[i]) {
+            mask |= std::uint64_t{1} << i;
+         }
+      }
+      if (mask != 0) {
+         write(player.frameNum - lastFrame);
+         write(mask);
+         for (std::size_t i = 0; i < Inputs::size; i++) {
+            if (mask & (std::uint64_t{1} << i)) {
+               write(reverseBits(bits[i] ^ settled[i]));
+            }
+         }
+         lastFrame = player.frameNum;
+      }
+   }
+
+   player.update(timestep);
+
+   if (file != nullptr) {
+      getBits(player, settled);
+      frame = player.frameNum;
+   }
+}
+
+void InputRecorder::write(std::uint64_t x)
+{
+   unsigned char bytes[10]{};
+   std::size_t n{};
+   do {
+      bytes[n] = static_cast<unsigned char>(x & 0x7f);
+      x >>= 7;
+      if (x != 0) {
+         bytes[n] |= 0x80;
+      }
+      n++;
+   } while (x != 0);
+   std::fwrite(bytes, 1, n, file);
+}
+
+InputReplay::~InputReplay() { close(); }
+
+bool InputReplay::open(const std::string& filename, const Player& player,
+                       const std::uint64_t modelHash)
+{
+   close();
+   file = std::fopen(filename.c_str(), "rb");
+   if (file == nullptr) {
+      std::cout << "Could not open input log : " << filename << std::endl;
+      return false;
+   }
+
+   if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+       std::memcmp(header.magic, inputlog::magic, sizeof(header.magic)) != 0) {
+      std::cout << "Not an input log : " << filename << std::endl;
+      close();
+      return false;
+   }
+   if (header.version != inputlog::version || header.byteOrder != inputlog::byteOrder ||
+       header.numInputs != Inputs::size) {
+      std::cout << "Input log was written by an incompatible version or machine : "
+                << filename << std::endl;
+      close();
+      return false;
+   }
+   if (header.modelHash != modelHash) {
+      std::cout << "Input log was recorded from another model or initial state : "
+                << filename << std::endl;
+      close();
+      return false;
+   }
+   if (header.startFrame != player.frameNum) {
+      std::cout << "Input log starts on frame " << header.startFrame
+                << ", the player is on frame " << player.frameNum << std::endl;
+      close();
+      return false;
+   }
+
+   good = true;
+   nextFrame = header.startFrame;
+   std::memset(settled, 0, sizeof(settled));
+   next();
+   if (!good) {
+      std::cout << "Input log is truncated : " << filename << std::endl;
+   }
+   return true;
+}
+
+void InputReplay::close()
+{
+   if (file != nullptr) {
+      std::fclose(file);
+      file = nullptr;
+   }
+   good = false;
+   nextMask = 0;
+}
+
+bool InputReplay::isDone(const Player& player) const
+{
+   return !good || (nextMask == 0 && player.frameNum >= nextFrame);
+}
+
+void InputReplay::update(Player& player, const double timestep)
+{
+   if (good && nextMask != 0 && player.frameNum >= nextFrame) {
+      if (player.frameNum != nextFrame) {
+         std::cout << "Input log does not follow the player's frames" << std::endl;
+         good = false;
+      } else {
+         for (std::size_t i = 0; i < Inputs::size; i++) {
+            if (nextMask & (std::uint64_t{1} << i)) {
+               Inputs::set(player, i, fromBits(reverseBits(nextValues[i]) ^ settled[i]));
+            }
+         }
+         next();
+      }
+   }
+
+   player.update(timestep);
+
+   if (good) {
+      getBits(player, settled);
+   }
+}
+
+bool InputReplay::read(std::uint64_t& x)
+{
+   x = 0;
+   for (unsigned shift = 0; shift < 64; shift += 7) {
+      const int byte{std::fgetc(file)};
+      if (byte == EOF) {
+         return false;
+      }
+      x |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+         return true;
+      }
+   }
+   return false;
+}
+
+void InputReplay::next()
+{
+   std::uint64_t frames{};
+   good = good && read(frames) && read(nextMask);
+   nextFrame += frames;
+   for (std::size_t i = 0; good && i < Inputs::size; i++) {
+      if (nextMask & (std::uint64_t{1} << i)) {
+         good = read(nextValues[i]);
+      }
+   }
+   if (!good) {
+      nextMask = 0;
+   }
+}
+}
+}
@@ -0,0 +1,57 @@
+
+#include "sflight/mdls/Pipeline.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/mdls/modules/AutoPilot.hpp"
+#include "sflight/mdls/modules/EOMFiveDOF.hpp"
+#include "sflight/mdls/modules/FileOutput.hpp"
+#include "sflight/mdls/modules/InterpAero.hpp"
+#include "sflight/mdls/modules/InverseDesign.hpp"
+#include "sflight/mdls/modules/StickControl.hpp"
+#include "sflight/mdls/modules/TableAero.hpp"
+#include "sflight/mdls/modules/WaypointFollower.hpp"
+
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+
+namespace {
+
+std::vector<PipelineFactory>& getPipelines()
+{
+   // the configurations of the example aircraft
+   static std::vector<PipelineFactory> pipelines{
+       StaticPipeline<FileOutput, EOMFiveDOF, AutoPilot, Atmosphere, StickControl,
+                      WaypointFollower, InverseDesign>::create,
+       StaticPipeline<EOMFiveDOF, InverseDesign, AutoPilot, Atmosphere, StickControl,
+                      WaypointFollower, FileOutput>::create,
+       StaticPipeline<EOMFiveDOF, InterpAero, Atmosphere, StickControl>::create,
+       StaticPipeline<TableAero, EOMFiveDOF, AutoPilot, Atmosphere, StickControl>::create,
+       StaticPipeline<EOMFiveDOF, Atmosphere, TableAero, AutoPilot>::create,
+   };
+   return pipelines;
+}
+}
+
+void addPipeline(const PipelineFactory x)
+{
+   std::vector<PipelineFactory>& pipelines{getPipelines()};
+   pipelines.insert(pipelines.begin(), x);
+}
+
+bool selectPipeline(Player* const player)
+{
+   const std::vector<PipelineFactory>& pipelines{getPipelines()};
+   for (std::size_t i = 0; i < pipelines.size(); i++) {
+      std::unique_ptr<Pipeline> pipeline{pipelines[i](player->modules)};
+      if (pipeline) {
+         player->setPipeline(std::move(pipeline));
+         return true;
+      }
+   }
+   return false;
+}
+}
+}
@@ -15,7 +15,9 @@
 #include "sflight/xml/node_utils.hpp"
 
 #include <cmath>
+#include <cstdint>
 #include <string>
+#include <utility>
 
 namespace sflight {
 namespace mdls {
@@ -32,20 +34,77 @@ Player::~Player()
 void Player::addModule(Module* const module)
 {
    modules.push_back(module);
+   if (auto x = dynamic_cast<const Atmosphere*>(module)) {
+      atmosphere = x;
+   }
+   scheduler.clear();
+   hasScheduleOrigin = false;
+   pipeline.reset();
+   if (profiler) {
+      profiler->setModules(modules);
+   }
 }
 
-void Player::update(const double x)
+void Player::setPipeline(std::unique_ptr<Pipeline> x)
 {
-   double timestep{x};
-   simTime += timestep;
+   pipeline = std::move(x);
+   scheduler.clear();
+}
 
-   for (std::size_t i = 0; i < modules.size(); i++) {
-      timestep = simTime - modules[i]->lastTime;
-      if (timestep >= modules[i]->frameTime) {
-         modules[i]->lastTime = simTime;
-         modules[i]->update(timestep);
+void Player::setProfiling(const bool x)
+{
+   if (!x) {
+      profiler.reset();
+   } else if (!profiler) {
+      profiler.reset(new Profiler);
+      profiler->setModules(modules);
+   }
+}
+
+const Euler& Player::getEulers() const
+{
+   if (!eulersValid) {
+      attitude.getEulers(eulers);
+      eulersValid = true;
+   }
+   return eulers;
+}
+
+void Player::setEulers(const Euler& x)
+{
+   attitude.initialize(x);
+   eulers = x;
+   eulersValid = true;
+}
+
+void Player::update(const double x)
+{
+   // ticks are frames; new modules or a new frame time start a new schedule
+   // from here, but rebuilding for the same ones (a new pipeline, a restored
+   // state) keeps counting
+   if (!scheduler.isBuilt() || x != scheduler.getTickTime()) {
+      scheduler.build(modules, x);
+      if (pipeline) {
+         pipeline->build(x);
+      }
+      if (!hasScheduleOrigin || x != scheduleTickTime) {
+         scheduleFrame = frameNum;
+         scheduleTime = simTime;
+         scheduleTickTime = x;
+         hasScheduleOrigin = true;
       }
    }
+
+   // time is counted in ticks, so it does not drift
+   const std::uint64_t tick{frameNum - scheduleFrame};
+   simTime = scheduleTime + static_cast<double>(tick + 1) * x;
+   if (profiler) {
+      scheduler.run(tick, simTime, *profiler);
+   } else if (pipeline) {
+      pipeline->run(tick, simTime);
+   } else {
+      scheduler.run(tick, simTime);
+   }
    frameNum++;
 }
 }
@@ -0,0 +1,203 @@
+
+#include "sflight/mdls/PlayerBatch.hpp"
+
+#include "sflight/mdls/batch/BatchAtmosphere.hpp"
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+#include "sflight/mdls/Euler.hpp"
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/Quaternion.hpp"
+#include "sflight/mdls/Vector3.hpp"
+
+#include <utility>
+
+namespace sflight {
+namespace mdls {
+
+namespace {
+std::size_t offsetOf(const Player& player, const double& member)
+{
+   return static_cast<std::size_t>(reinterpret_cast<const char*>(&member) -
+                                   reinterpret_cast<const char*>(&player));
+}
+}
+
+PlayerBatch::~PlayerBatch()
+{
+   for (std::size_t i = 0; i < modules.size(); i++) {
+      delete modules[i];
+   }
+}
+
+std::size_t PlayerBatch::add(Player* const player)
+{
+   const std::size_t index{count++};
+
+   lat.push_back(player->lat);
+   lon.push_back(player->lon);
+   alt.push_back(player->alt);
+   mass.push_back(player->mass);
+   rho.push_back(player->rho);
+   vInf.push_back(player->vInf);
+   mach.push_back(player->mach);
+   alpha.push_back(player->alpha);
+   beta.push_back(player->beta);
+   alphaDot.push_back(player->alphaDot);
+   betaDot.push_back(player->betaDot);
+   altagl.push_back(player->altagl);
+   terrainElev.push_back(player->terrainElev);
+   g.push_back(player->g);
+
+   uvw.push_back(player->uvw);
+   uvwdot.push_back(player->uvwdot);
+   pqr.push_back(player->pqr);
+   pqrdot.push_back(player->pqrdot);
+   const Quaternion& attitude{player->getAttitude()};
+   qw.push_back(attitude.getEo());
+   qx.push_back(attitude.getEx());
+   qy.push_back(attitude.getEy());
+   qz.push_back(attitude.getEz());
+   eulers.push_back(player->getEulers());
+   thrust.push_back(player->thrust);
+   thrustMoment.push_back(player->thrustMoment);
+   aeroForce.push_back(player->aeroForce);
+   aeroMoment.push_back(player->aeroMoment);
+   nedVel.push_back(player->nedVel);
+   xyz.push_back(player->xyz);
+   deflections.push_back(player->deflections);
+   windVel.push_back(player->windVel);
+   windGust.push_back(player->windGust);
+
+   throttle.push_back(player->throttle);
+   rpm.push_back(player->rpm);
+   fuel.push_back(player->fuel);
+   fuelflow.push_back(player->fuelflow);
+
+   autoPilotCmds.push_back(player->autoPilotCmds);
+
+   return index;
+}
+
+void PlayerBatch::get(const std::size_t index, Player* const player) const
+{
+   if (index >= count) {
+      return;
+   }
+
+   player->lat = lat[index];
+   player->lon = lon[index];
+   player->alt = alt[index];
+   player->mass = mass[index];
+   player->rho = rho[index];
+   player->vInf = vInf[index];
+   player->mach = mach[index];
+   player->alpha = alpha[index];
+   player->beta = beta[index];
+   player->alphaDot = alphaDot[index];
+   player->betaDot = betaDot[index];
+   player->altagl = altagl[index];
+   player->terrainElev = terrainElev[index];
+   player->g = g[index];
+
+   uvw.get(index, player->uvw);
+   uvwdot.get(index, player->uvwdot);
+   pqr.get(index, player->pqr);
+   pqrdot.get(index, player->pqrdot);
+   player->setAttitude(Quaternion(qw[index], qx[index], qy[index], qz[index]));
+   thrust.get(index, player->thrust);
+   thrustMoment.get(index, player->thrustMoment);
+   aeroForce.get(index, player->aeroForce);
+   aeroMoment.get(index, player->aeroMoment);
+   nedVel.get(index, player->nedVel);
+   xyz.get(index, player->xyz);
+   deflections.get(index, player->deflections);
+   windVel.get(index, player->windVel);
+   windGust.get(index, player->windGust);
+
+   player->throttle = throttle[index];
+   player->rpm = rpm[index];
+   player->fuel = fuel[index];
+   player->fuelflow = fuelflow[index];
+
+   player->autoPilotCmds = autoPilotCmds[index];
+
+   player->frameNum = frameNum;
+   player->simTime = simTime;
+   player->paused = paused;
+}
+
+const double* PlayerBatch::getField(const std::size_t offset, std::size_t* const stride) const
+{
+   *stride = 1;
+   // offsets are measured on a player, as in PlayerField
+   static const Player p;
+   const Euler& e{p.getEulers()};
+   const std::pair<const double&, const std::vector<double>&> fields[]{
+       {p.lat, lat},                       {p.lon, lon},
+       {p.alt, alt},                       {p.mass, mass},
+       {p.rho, rho},                       {p.vInf, vInf},
+       {p.mach, mach},                     {p.alpha, alpha},
+       {p.beta, beta},                     {p.alphaDot, alphaDot},
+       {p.betaDot, betaDot},               {p.altagl, altagl},
+       {p.terrainElev, terrainElev},       {p.g, g},
+       {p.uvw.a1, uvw.a1},                 {p.uvw.a2, uvw.a2},
+       {p.uvw.a3, uvw.a3},                 {p.uvwdot.a1, uvwdot.a1},
+       {p.uvwdot.a2, uvwdot.a2},           {p.uvwdot.a3, uvwdot.a3},
+       {p.pqr.a1, pqr.a1},                 {p.pqr.a2, pqr.a2},
+       {p.pqr.a3, pqr.a3},                 {p.pqrdot.a1, pqrdot.a1},
+       {p.pqrdot.a2, pqrdot.a2},           {p.pqrdot.a3, pqrdot.a3},
+       {e.a1, eulers.a1},                  {e.a2, eulers.a2},
+       {e.a3, eulers.a3},                  {p.thrust.a1, thrust.a1},
+       {p.thrust.a2, thrust.a2},           {p.thrust.a3, thrust.a3},
+       {p.thrustMoment.a1, thrustMoment.a1}, {p.thrustMoment.a2, thrustMoment.a2},
+       {p.thrustMoment.a3, thrustMoment.a3}, {p.aeroForce.a1, aeroForce.a1},
+       {p.aeroForce.a2, aeroForce.a2},     {p.aeroForce.a3, aeroForce.a3},
+       {p.aeroMoment.a1, aeroMoment.a1},   {p.aeroMoment.a2, aeroMoment.a2},
+       {p.aeroMoment.a3, aeroMoment.a3},   {p.nedVel.a1, nedVel.a1},
+       {p.nedVel.a2, nedVel.a2},           {p.nedVel.a3, nedVel.a3},
+       {p.xyz.a1, xyz.a1},                 {p.xyz.a2, xyz.a2},
+       {p.xyz.a3, xyz.a3},                 {p.deflections.a1, deflections.a1},
+       {p.deflections.a2, deflections.a2}, {p.deflections.a3, deflections.a3},
+       {p.windVel.a1, windVel.a1},         {p.windVel.a2, windVel.a2},
+       {p.windVel.a3, windVel.a3},         {p.windGust.a1, windGust.a1},
+       {p.windGust.a2, windGust.a2},       {p.windGust.a3, windGust.a3},
+       {p.throttle, throttle},             {p.rpm, rpm},
+       {p.fuel, fuel},                     {p.fuelflow, fuelflow}};
+   for (const auto& field : fields) {
+      if (offsetOf(p, field.first) == offset) {
+         return field.second.data();
+      }
+   }
+   if (offsetOf(p, p.simTime) == offset) {
+      *stride = 0;
+      return &simTime;
+   }
+   return nullptr;
+}
+
+void PlayerBatch::addModule(BatchModule* const module)
+{
+   modules.push_back(module);
+   if (auto x = dynamic_cast<const BatchAtmosphere*>(module)) {
+      atmosphere = x;
+   }
+   scheduler.clear();
+}
+
+void PlayerBatch::update(const double x)
+{
+   // ticks are frames; a new frame time starts a new schedule from here
+   if (!scheduler.isBuilt() || x != scheduler.getTickTime()) {
+      scheduler.build(modules, x);
+      scheduleFrame = frameNum;
+      scheduleTime = simTime;
+   }
+
+   // time is counted in ticks, so it does not drift
+   const std::uint64_t tick{frameNum - scheduleFrame};
+   simTime = scheduleTime + static_cast<double>(tick + 1) * x;
+   scheduler.run(tick, simTime);
+   frameNum++;
+}
+}
+}
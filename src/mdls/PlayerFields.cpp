@@ -0,0 +1,128 @@
+
+#include "sflight/mdls/PlayerFields.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/UnitConvert.hpp"
+
+#include <string>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+
+namespace {
+
+PlayerField field(const Player& player, const double& member, const char* name,
+                  const char* unit, double (*convert)(const double), const int precision = 4)
+{
+   PlayerField x;
+   x.name = name;
+   x.unit = unit;
+   x.convert = convert;
+   x.precision = precision;
+   x.offset = static_cast<std::size_t>(reinterpret_cast<const char*>(&member) -
+                                       reinterpret_cast<const char*>(&player));
+   return x;
+}
+}
+
+double PlayerField::get(const Player& player) const
+{
+   // the euler angles are only kept up to date when asked for
+   player.getEulers();
+   return *reinterpret_cast<const double*>(reinterpret_cast<const char*>(&player) + offset);
+}
+
+std::string PlayerField::getTitle() const
+{
+   const std::string x{unit};
+   return x.empty() ? std::string(name) : std::string(name) + "(" + x + ")";
+}
+
+const std::vector<PlayerField>& getPlayerFields()
+{
+   // offsets are measured on a player, so any member can be listed
+   static const Player p;
+   static const std::vector<PlayerField> fields{
+       field(p, p.simTime,              "Time",              "sec",    nullptr, 3),
+       field(p, p.lat,                  "Lat",               "deg",    UnitConvert::toDegs),
+       field(p, p.lon,                  "Lon",               "deg",    UnitConvert::toDegs),
+       field(p, p.alt,                  "Alt",               "ft",     UnitConvert::toFeet),
+       field(p, p.vInf,                 "Speed",             "ktas",   UnitConvert::toKnots),
+       field(p, p.eulers.a3,            "Bank",              "deg",    UnitConvert::toDegs),
+       field(p, p.eulers.a2,            "Pitch",             "deg",    UnitConvert::toDegs),
+       field(p, p.eulers.a1,            "Heading",           "deg",    UnitConvert::toDegs),
+       field(p, p.throttle,             "Throttle",          "",       nullptr),
+
+       field(p, p.mass,                 "Mass",              "kg",     nullptr),
+       field(p, p.rho,                  "Rho",               "kg/m3",  nullptr),
+       field(p, p.mach,                 "Mach",              "",       nullptr),
+       field(p, p.alpha,                "Alpha",             "deg",    UnitConvert::toDegs),
+       field(p, p.beta,                 "Beta",              "deg",    UnitConvert::toDegs),
+       field(p, p.alphaDot,             "AlphaDot",          "deg/s",  UnitConvert::toDegs),
+       field(p, p.betaDot,              "BetaDot",           "deg/s",  UnitConvert::toDegs),
+       field(p, p.altagl,               "AltAGL",            "ft",     UnitConvert::toFeet),
+       field(p, p.terrainElev,          "TerrainElev",       "ft",     UnitConvert::toFeet),
+       field(p, p.g,                    "G",                 "m/s2",   nullptr),
+
+       field(p, p.uvw.a1,               "U",                 "m/s",    nullptr),
+       field(p, p.uvw.a2,               "V",                 "m/s",    nullptr),
+       field(p, p.uvw.a3,               "W",                 "m/s",    nullptr),
+       field(p, p.uvwdot.a1,            "UDot",              "m/s2",   nullptr),
+       field(p, p.uvwdot.a2,            "VDot",              "m/s2",   nullptr),
+       field(p, p.uvwdot.a3,            "WDot",              "m/s2",   nullptr),
+       field(p, p.pqr.a1,               "P",                 "deg/s",  UnitConvert::toDegs),
+       field(p, p.pqr.a2,               "Q",                 "deg/s",  UnitConvert::toDegs),
+       field(p, p.pqr.a3,               "R",                 "deg/s",  UnitConvert::toDegs),
+       field(p, p.pqrdot.a1,            "PDot",              "deg/s2", UnitConvert::toDegs),
+       field(p, p.pqrdot.a2,            "QDot",              "deg/s2", UnitConvert::toDegs),
+       field(p, p.pqrdot.a3,            "RDot",              "deg/s2", UnitConvert::toDegs),
+
+       field(p, p.thrust.a1,            "ThrustX",           "N",      nullptr),
+       field(p, p.thrust.a2,            "ThrustY",           "N",      nullptr),
+       field(p, p.thrust.a3,            "ThrustZ",           "N",      nullptr),
+       field(p, p.thrustMoment.a1,      "ThrustRollMoment",  "N-m",    nullptr),
+       field(p, p.thrustMoment.a2,      "ThrustPitchMoment", "N-m",    nullptr),
+       field(p, p.thrustMoment.a3,      "ThrustYawMoment",   "N-m",    nullptr),
+       field(p, p.aeroForce.a1,         "AeroX",             "N",      nullptr),
+       field(p, p.aeroForce.a2,         "AeroY",             "N",      nullptr),
+       field(p, p.aeroForce.a3,         "AeroZ",             "N",      nullptr),
+       field(p, p.aeroMoment.a1,        "AeroRollMoment",    "N-m",    nullptr),
+       field(p, p.aeroMoment.a2,        "AeroPitchMoment",   "N-m",    nullptr),
+       field(p, p.aeroMoment.a3,        "AeroYawMoment",     "N-m",    nullptr),
+
+       field(p, p.nedVel.a1,            "VNorth",            "m/s",    nullptr),
+       field(p, p.nedVel.a2,            "VEast",             "m/s",    nullptr),
+       field(p, p.nedVel.a3,            "VDown",             "m/s",    nullptr),
+       field(p, p.xyz.a1,               "North",             "m",      nullptr),
+       field(p, p.xyz.a2,               "East",              "m",      nullptr),
+       field(p, p.xyz.a3,               "Down",              "m",      nullptr),
+       field(p, p.deflections.a1,       "Aileron",           "deg",    UnitConvert::toDegs),
+       field(p, p.deflections.a2,       "Elevator",          "deg",    UnitConvert::toDegs),
+       field(p, p.deflections.a3,       "Rudder",            "deg",    UnitConvert::toDegs),
+       field(p, p.windVel.a1,           "WindNorth",         "m/s",    nullptr),
+       field(p, p.windVel.a2,           "WindEast",          "m/s",    nullptr),
+       field(p, p.windVel.a3,           "WindDown",          "m/s",    nullptr),
+       field(p, p.windGust.a1,          "GustNorth",         "m/s",    nullptr),
+       field(p, p.windGust.a2,          "GustEast",          "m/s",    nullptr),
+       field(p, p.windGust.a3,          "GustDown",          "m/s",    nullptr),
+
+       field(p, p.rpm,                  "Rpm",               "",       nullptr),
+       field(p, p.fuel,                 "Fuel",              "kg",     nullptr),
+       field(p, p.fuelflow,             "FuelFlow",          "kg/s",   nullptr),
+   };
+   return fields;
+}
+
+const PlayerField* findPlayerField(const std::string& name)
+{
+   const std::vector<PlayerField>& fields{getPlayerFields()};
+   for (std::size_t i = 0; i < fields.size(); i++) {
+      if (name == fields[i].name) {
+         return &fields[i];
+      }
+   }
+   return nullptr;
+}
+}
+}
@@ -0,0 +1,101 @@
+
+#include "sflight/mdls/Profiler.hpp"
+
+#include "sflight/mdls/modules/Module.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <ostream>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace sflight {
+namespace mdls {
+
+std::string Profiler::getName(const Module& module)
+{
+   std::string name{typeid(module).name()};
+#if defined(__GNUG__)
+   int status{};
+   char* const demangled{abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status)};
+   if (status == 0 && demangled != nullptr) {
+      name = demangled;
+   }
+   std::free(demangled);
+#endif
+   const std::size_t scope{name.rfind("::")};
+   return scope == std::string::npos ? name : name.substr(scope + 2);
+}
+
+void Profiler::setModules(const std::vector<Module*>& modules)
+{
+   const std::size_t n{entries.size()};
+   entries.resize(modules.size());
+   for (std::size_t i = n; i < modules.size(); i++) {
+      entries[i].name = getName(*modules[i]);
+   }
+}
+
+void Profiler::add(const Profiler& x)
+{
+   for (std::size_t i = 0; i < x.entries.size(); i++) {
+      std::size_t j{};
+      while (j < entries.size() && entries[j].name != x.entries[i].name) {
+         j++;
+      }
+      if (j == entries.size()) {
+         entries.emplace_back();
+         entries[j].name = x.entries[i].name;
+      }
+      entries[j].total += x.entries[i].total;
+      entries[j].times.add(x.entries[i].times);
+   }
+}
+
+void Profiler::clear()
+{
+   for (std::size_t i = 0; i < entries.size(); i++) {
+      entries[i].total = 0;
+      entries[i].times.clear();
+   }
+}
+
+std::uint64_t Profiler::getTotal() const
+{
+   std::uint64_t total{};
+   for (std::size_t i = 0; i < entries.size(); i++) {
+      total += entries[i].total;
+   }
+   return total;
+}
+
+void Profiler::print(std::ostream& out) const
+{
+   const double total{static_cast<double>(getTotal())};
+   const auto flags = out.flags();
+   const auto precision = out.precision();
+
+   out << std::left << std::setw(20) << "module" << std::right << std::setw(10) << "calls"
+       << std::setw(12) << "total(ms)" << std::setw(8) << "share" << std::setw(10) << "mean(us)"
+       << std::setw(10) << "min(us)" << std::setw(10) << "p50(us)" << std::setw(10)
+       << "p99(us)" << std::setw(10) << "max(us)" << std::endl;
+   out << std::fixed;
+   for (std::size_t i = 0; i < entries.size(); i++) {
+      const Entry& x{entries[i]};
+      out << std::left << std::setw(20) << x.name << std::right << std::setw(10)
+          << x.times.getCount() << std::setprecision(3) << std::setw(12) << x.total / 1e6
+          << std::setprecision(1) << std::setw(7) << (total > 0 ? 100 * x.total / total : 0)
+          << "%" << std::setprecision(3) << std::setw(10) << x.times.getMean() / 1e3
+          << std::setw(10) << x.times.getMin() / 1e3 << std::setw(10)
+          << x.times.getPercentile(0.5) / 1e3 << std::setw(10)
+          << x.times.getPercentile(0.99) / 1e3 << std::setw(10) << x.times.getMax() / 1e3
+          << std::endl;
+   }
+   out.flags(flags);
+   out.precision(precision);
+}
+}
+}
@@ -1,6 +1,7 @@
 
 #include "sflight/mdls/Quaternion.hpp"
 #include "sflight/mdls/Euler.hpp"
+#include "sflight/mdls/Vector3.hpp"
 
 #include <iostream>
 #include <cmath>
@@ -26,7 +27,7 @@ Quaternion::Quaternion(const double eo, const double ex, const double ey, const
    this->ez = ez;
 }
 
-Quaternion::Quaternion(Euler &euler)
+Quaternion::Quaternion(const Euler &euler)
 {
    initialize(euler.getPsi(), euler.getTheta(), euler.getPhi());
 }
@@ -52,24 +53,24 @@ double Quaternion::getEz() const
    return this->ez;
 }
 
-double Quaternion::getPsi()
+double Quaternion::getPsi() const
 {
    const double m11 = eo * eo + ex * ex - ey * ey - ez * ez;
    return std::atan2(2.0 * (eo * ez + ex * ey), m11);
 }
 
-double Quaternion::getTheta()
+double Quaternion::getTheta() const
 {
    return std::asin(2 * (eo * ey - ex * ez));
 }
 
-double Quaternion::getPhi()
+double Quaternion::getPhi() const
 {
    const double m33 = eo * eo + ez * ez - ex * ex - ey * ey;
    return std::atan2(2.0 * (eo * ex + ey * ez), m33);
 }
 
-void Quaternion::getEulers(Euler &euler)
+void Quaternion::getEulers(Euler &euler) const
 {
    euler.setPsi(getPsi());
    euler.setTheta(getTheta());
@@ -77,7 +78,7 @@ void Quaternion::getEulers(Euler &euler)
 }
 
 /** sets the value of world axis velocities (dxdydz) based on the passed body-axis (uvw) velocities */
-void Quaternion::getDxDyDz(Vector3 &dxdydz, Vector3 &uvw)
+void Quaternion::getDxDyDz(Vector3 &dxdydz, const Vector3 &uvw) const
 {
    const double a11 = ex * ex + eo * eo - ey * ey - ez * ez;
    const double a12 = 2.0 * (ex * ey - ez * eo);
@@ -95,7 +96,7 @@ void Quaternion::getDxDyDz(Vector3 &dxdydz, Vector3 &uvw)
 }
 
 /** sets the value of body axis velocities (uvw) based on the passed world axis velocities (dxdydz) */
-void Quaternion::getUVW(Vector3 &uvw, Vector3 &dxdydz)
+void Quaternion::getUVW(Vector3 &uvw, const Vector3 &dxdydz) const
 {
    const double a11 = ex * ex + eo * eo - ey * ey - ez * ez;
    const double a21 = 2.0 * (ex * ey - ez * eo);
@@ -112,7 +113,7 @@ void Quaternion::getUVW(Vector3 &uvw, Vector3 &dxdydz)
    uvw.set3(a31 * dxdydz.get1() + a32 * dxdydz.get2() + a33 * dxdydz.get3());
 }
 
-void Quaternion::getQdot(Quaternion &toFill, double p, double q, double r)
+void Quaternion::getQdot(Quaternion &toFill, double p, double q, double r) const
 {
 
    toFill.eo = 0.5 * (-p * ex - q * ey - r * ez);
@@ -121,7 +122,15 @@ void Quaternion::getQdot(Quaternion &toFill, double p, double q, double r)
    toFill.ez = 0.5 * (r * eo + q * ex - p * ey);
 }
 
-void Quaternion::initialize(Euler &euler)
+/** sets 'down' to the earth axis down direction in body axes (the third row of the body to earth rotation) */
+void Quaternion::getDown(Vector3 &down) const
+{
+   down.set1(2.0 * (ex * ez - ey * eo));
+   down.set2(2.0 * (ey * ez + ex * eo));
+   down.set3(ez * ez + eo * eo - ex * ex - ey * ey);
+}
+
+void Quaternion::initialize(const Euler &euler)
 {
    initialize(euler.getPsi(), euler.getTheta(), euler.getPhi());
 }
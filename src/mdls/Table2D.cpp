@@ -17,6 +17,9 @@ Table2D::Table2D(const std::size_t numRows, const std::size_t numCols, double ro
    this->numRows = numRows;
    this->numCols = numCols;
 
+   rowAxis = TableAxis(rowVals, numRows);
+   colAxis = TableAxis(colVals, numCols);
+
    // double data[numRows][numCols];
    data = new double*[numRows];
 
@@ -76,33 +79,13 @@ void Table2D::multiply(const double val)
 
 double Table2D::interp(const double rowVal, const double colVal)
 {
-   int lowrow{};
-   int highrow{};
-   double rowweight{};
-
-   int lowcol{};
-   int highcol{};
-   double colweight{};
-
-   for (std::size_t i = 1; i < numRows; i++) {
-      lowrow = i - 1;
-      highrow = i;
-      if (rowVals[i] > rowVal) {
-         break;
-      }
-   }
-   if (numRows > 1)
-      rowweight = (rowVal - rowVals[lowrow]) / (rowVals[highrow] - rowVals[lowrow]);
-
-   for (std::size_t i = 1; i < numCols; i++) {
-      lowcol = i - 1;
-      highcol = i;
-      if (colVals[i] > colVal) {
-         break;
-      }
-   }
-   if (numCols > 1)
-      colweight = (colVal - colVals[lowcol]) / (colVals[highcol] - colVals[lowcol]);
+   const std::size_t lowrow{rowAxis.find(rowVal)};
+   const std::size_t highrow{numRows > 1 ? lowrow + 1 : lowrow};
+   const double rowweight{rowAxis.getWeight(lowrow, rowVal)};
+
+   const std::size_t lowcol{colAxis.find(colVal)};
+   const std::size_t highcol{numCols > 1 ? lowcol + 1 : lowcol};
+   const double colweight{colAxis.getWeight(lowcol, colVal)};
 
    const double firstRow{data[lowrow][lowcol] + (data[lowrow][highcol] - data[lowrow][lowcol]) * colweight};
    const double secRow{data[highrow][lowcol] + (data[highrow][highcol] - data[highrow][lowcol]) * colweight};
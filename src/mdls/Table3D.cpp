@@ -7,7 +7,7 @@ namespace sflight {
 namespace mdls {
 
 Table3D::Table3D(const std::size_t numPages, double pageVals[])
-    : pageVals(pageVals), numPages(numPages)
+    : pageVals(pageVals), numPages(numPages), pageAxis(pageVals, numPages)
 {
    data = new Table2D*[numPages];
 }
@@ -47,20 +47,9 @@ Table2D* Table3D::getPage(const std::size_t page)
 
 double Table3D::interp(const double pageVal, const double rowVal, const double colVal)
 {
-   std::size_t lowpage{};
-   std::size_t highpage{};
-   double pageweight{};
-
-   for (std::size_t i = 1; i < numPages; i++) {
-      lowpage = i - 1;
-      highpage = i;
-      if (pageVals[i] > pageVal) {
-         break;
-      }
-   }
-   if (numPages > 1) {
-      pageweight = (pageVal - pageVals[lowpage]) / (pageVals[highpage] - pageVals[lowpage]);
-   }
+   const std::size_t lowpage{pageAxis.find(pageVal)};
+   const std::size_t highpage{numPages > 1 ? lowpage + 1 : lowpage};
+   const double pageweight{pageAxis.getWeight(lowpage, pageVal)};
 
    const double firstpage{data[lowpage]->interp(rowVal, colVal)};
    const double secpage{data[highpage]->interp(rowVal, colVal)};
@@ -0,0 +1,69 @@
+
+#include "sflight/mdls/TableAxis.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+TableAxis::TableAxis(const double vals[], const std::size_t size) : vals(vals), n(size)
+{
+   if (n < 3) {
+      return;
+   }
+
+   // the direct index is corrected against the breakpoints in find(), so the
+   // spacing only has to be close to uniform
+   const double step{(vals[n - 1] - vals[0]) / (n - 1)};
+   if (!(step > 0.0)) {
+      return;
+   }
+   for (std::size_t i = 1; i < n - 1; i++) {
+      if (std::fabs(vals[i] - (vals[0] + i * step)) > 1e-6 * step) {
+         return;
+      }
+   }
+   uniform = true;
+   first = vals[0];
+   invStep = 1.0 / step;
+}
+
+std::size_t TableAxis::find(const double x)
+{
+   if (n < 2) {
+      return 0;
+   }
+   const std::size_t last{n - 2};
+
+   // same interval as last time, or a neighbour
+   if (contains(hint, x)) {
+      return hint;
+   }
+   if (hint < last && contains(hint + 1, x)) {
+      return ++hint;
+   }
+   if (hint > 0 && contains(hint - 1, x)) {
+      return --hint;
+   }
+
+   std::size_t i{};
+   if (uniform) {
+      const double t{(x - first) * invStep};
+      i = t > 0.0 ? (t < last ? static_cast<std::size_t>(t) : last) : 0;
+      while (i > 0 && vals[i] > x) {
+         i--;
+      }
+      while (i < last && vals[i + 1] <= x) {
+         i++;
+      }
+   } else {
+      // first breakpoint past x, excluding the two ends
+      i = std::upper_bound(vals + 1, vals + n - 1, x) - vals - 1;
+   }
+
+   hint = i;
+   return i;
+}
+}
+}
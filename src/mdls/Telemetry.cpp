@@ -0,0 +1,154 @@
+
+#include "sflight/mdls/Telemetry.hpp"
+
+#include "sflight/mdls/Player.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace sflight {
+namespace mdls {
+
+Channels Channels::standard()
+{
+   Channels x;
+   const char* names[]{"Time", "Lat", "Lon", "Alt", "Speed", "Bank", "Pitch", "Heading",
+                       "Throttle"};
+   for (std::size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+      x.add(names[i]);
+   }
+   return x;
+}
+
+bool Channels::add(const std::string& name, const std::size_t decimation)
+{
+   const PlayerField* field{findPlayerField(name)};
+   if (field == nullptr) {
+      return false;
+   }
+   fields.push_back(field);
+   offsets.push_back(field->offset);
+   decimations.push_back(decimation > 0 ? decimation : 1);
+   return true;
+}
+
+std::size_t Channels::count(const std::size_t frame) const
+{
+   std::size_t n{};
+   for (std::size_t i = 0; i < decimations.size(); i++) {
+      if (frame % decimations[i] == 0) {
+         n++;
+      }
+   }
+   return n;
+}
+
+std::size_t Channels::gather(const Player& player, const std::size_t frame,
+                             double* const packed) const
+{
+   // the euler angles are only kept up to date when asked for
+   player.getEulers();
+   const char* const base{reinterpret_cast<const char*>(&player)};
+   std::size_t n{};
+   for (std::size_t i = 0; i < offsets.size(); i++) {
+      if (frame % decimations[i] == 0) {
+         packed[n++] = *reinterpret_cast<const double*>(base + offsets[i]);
+      }
+   }
+   return n;
+}
+
+void Channels::scatter(const std::size_t frame, const double* const packed,
+                       double* const values) const
+{
+   std::size_t n{};
+   for (std::size_t i = 0; i < decimations.size(); i++) {
+      if (frame % decimations[i] == 0) {
+         values[i] = packed[n++];
+      }
+   }
+}
+
+void writeTextHeader(std::ostream& out, const Channels& channels)
+{
+   for (std::size_t i = 0; i < channels.size(); i++) {
+      out << std::setw(14) << channels.getField(i).getTitle();
+   }
+}
+
+void writeText(std::ostream& out, const Channels& channels, const double* const values)
+{
+   out << std::fixed;
+   for (std::size_t i = 0; i < channels.size(); i++) {
+      const PlayerField& field{channels.getField(i)};
+      out << std::setprecision(field.precision);
+      out << std::setw(14) << (field.convert ? field.convert(values[i]) : values[i]);
+   }
+}
+
+bool convertTelemetry(const std::string& logFilename, const std::string& textFilename)
+{
+   std::ifstream fin(logFilename, std::ifstream::binary);
+   if (!fin) {
+      std::cout << "Could not open telemetry log : " << logFilename << std::endl;
+      return false;
+   }
+
+   TelemetryHeader header;
+   if (!fin.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+       std::memcmp(header.magic, telemetry::magic, sizeof(header.magic)) != 0) {
+      std::cout << "Not a telemetry log : " << logFilename << std::endl;
+      return false;
+   }
+   if (header.version != telemetry::version || header.byteOrder != telemetry::byteOrder) {
+      std::cout << "Telemetry log was written by an incompatible version or machine : "
+                << logFilename << std::endl;
+      return false;
+   }
+
+   Channels channels;
+   for (std::uint32_t i = 0; i < header.numChannels; i++) {
+      TelemetryChannel channel;
+      if (!fin.read(reinterpret_cast<char*>(&channel), sizeof(channel))) {
+         std::cout << "Telemetry log is truncated : " << logFilename << std::endl;
+         return false;
+      }
+      channel.name[TelemetryChannel::maxName - 1] = '\0';
+      if (!channels.add(channel.name, static_cast<std::size_t>(channel.decimation))) {
+         std::cout << "Unknown telemetry channel : " << channel.name << std::endl;
+         return false;
+      }
+   }
+
+   std::ofstream fout(textFilename);
+   if (!fout) {
+      std::cout << "Could not open output file : " << textFilename << std::endl;
+      return false;
+   }
+   writeTextHeader(fout, channels);
+   fout << '\n';
+
+   std::vector<double> packed(channels.size());
+   std::vector<double> values(channels.size());
+   for (std::size_t frame = 0; !channels.empty(); frame++) {
+      // frames with no channel due hold no data; they end with the log
+      const std::size_t n{channels.count(frame)};
+      if (fin.peek() == std::char_traits<char>::eof()) {
+         break;
+      }
+      if (!fin.read(reinterpret_cast<char*>(packed.data()), n * sizeof(double))) {
+         break;
+      }
+      channels.scatter(frame, packed.data(), values.data());
+      writeText(fout, channels, values.data());
+      fout << '\n';
+   }
+   if (fin.gcount() != 0) {
+      std::cout << "Telemetry log ends with a partial frame : " << logFilename << std::endl;
+   }
+   return static_cast<bool>(fout);
+}
+}
+}
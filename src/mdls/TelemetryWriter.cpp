@@ -0,0 +1,222 @@
+
+#include "sflight/mdls/TelemetryWriter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sflight {
+namespace mdls {
+
+//------------------------------------------------------------------------------
+// Class: TelemetryDrain
+// Description: The background thread emptying the rings of the open writers.
+//              Writers share it while any is open; the last to close stops it.
+//------------------------------------------------------------------------------
+class TelemetryDrain
+{
+ public:
+   TelemetryDrain() : thread(&TelemetryDrain::run, this) {}
+   TelemetryDrain(const TelemetryDrain&) = delete;
+   TelemetryDrain& operator=(const TelemetryDrain&) = delete;
+
+   ~TelemetryDrain()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stopping = true;
+      }
+      wake.notify_one();
+      thread.join();
+   }
+
+   // the drain in use, or a new one if no writer is open
+   static std::shared_ptr<TelemetryDrain> acquire()
+   {
+      std::lock_guard<std::mutex> lock(sharedMutex);
+      std::shared_ptr<TelemetryDrain> x{shared.lock()};
+      if (!x) {
+         x = std::make_shared<TelemetryDrain>();
+         shared = x;
+      }
+      return x;
+   }
+
+   void add(TelemetryWriter* const x)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      writers.push_back(x);
+   }
+
+   // once this returns, the writer is no longer touched by the thread
+   void remove(TelemetryWriter* const x)
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      writers.erase(std::remove(writers.begin(), writers.end(), x), writers.end());
+      idle.wait(lock, [this]() { return !draining; });
+   }
+
+   // asks for a pass now rather than at the next interval
+   void notify()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         pending = true;
+      }
+      wake.notify_one();
+   }
+
+ private:
+   void run()
+   {
+      std::vector<TelemetryWriter*> list;
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!stopping) {
+         // the rings are emptied without the lock, so writers come and go freely
+         list = writers;
+         draining = true;
+         pending = false;
+         lock.unlock();
+         for (std::size_t i = 0; i < list.size(); i++) {
+            list[i]->drain();
+         }
+         lock.lock();
+         draining = false;
+         idle.notify_all();
+         wake.wait_for(lock, interval, [this]() { return pending || stopping; });
+      }
+   }
+
+   // longest a value waits in a ring that is less than half full
+   static constexpr std::chrono::milliseconds interval{100};
+
+   static std::mutex sharedMutex;
+   static std::weak_ptr<TelemetryDrain> shared;
+
+   std::mutex mutex;
+   std::condition_variable wake;
+   std::condition_variable idle;
+   std::vector<TelemetryWriter*> writers;
+   bool draining{};
+   bool pending{};
+   bool stopping{};
+   std::thread thread;
+};
+
+constexpr std::chrono::milliseconds TelemetryDrain::interval;
+std::mutex TelemetryDrain::sharedMutex;
+std::weak_ptr<TelemetryDrain> TelemetryDrain::shared;
+
+TelemetryWriter::TelemetryWriter(const std::size_t capacity)
+{
+   std::size_t n{1};
+   while (n < capacity) {
+      n *= 2;
+   }
+   mask = n - 1;
+}
+
+TelemetryWriter::~TelemetryWriter() { close(); }
+
+bool TelemetryWriter::open(const std::string& filename, const Channels& channels)
+{
+   close();
+
+   file = std::fopen(filename.c_str(), "wb");
+   if (file == nullptr) {
+      std::cout << "Could not open telemetry log : " << filename << std::endl;
+      return false;
+   }
+   std::setvbuf(file, nullptr, _IOFBF, 64 * 1024);
+   if (!ring) {
+      ring.reset(new double[mask + 1]);
+   }
+
+   TelemetryHeader header;
+   std::memcpy(header.magic, telemetry::magic, sizeof(header.magic));
+   header.version = telemetry::version;
+   header.byteOrder = telemetry::byteOrder;
+   header.numChannels = static_cast<std::uint32_t>(channels.size());
+   std::fwrite(&header, sizeof(header), 1, file);
+   for (std::size_t i = 0; i < channels.size(); i++) {
+      TelemetryChannel channel;
+      std::strncpy(channel.name, channels.getField(i).name, TelemetryChannel::maxName - 1);
+      channel.decimation = channels.getDecimation(i);
+      std::fwrite(&channel, sizeof(channel), 1, file);
+   }
+
+   head.store(0, std::memory_order_relaxed);
+   tail.store(0, std::memory_order_relaxed);
+   drainer = TelemetryDrain::acquire();
+   drainer->add(this);
+   return true;
+}
+
+void TelemetryWriter::close()
+{
+   if (file == nullptr) {
+      return;
+   }
+   drainer->remove(this);
+   drain();
+   std::fclose(file);
+   file = nullptr;
+   drainer.reset();
+}
+
+void TelemetryWriter::write(const double* const values, const std::size_t n)
+{
+   std::size_t h{head.load(std::memory_order_relaxed)};
+   const std::size_t used{h - tail.load(std::memory_order_acquire)};
+   if (used + n <= mask + 1) {
+      for (std::size_t i = 0; i < n; i++) {
+         ring[(h + i) & mask] = values[i];
+      }
+      head.store(h + n, std::memory_order_release);
+      // the drain is woken as the ring passes half full
+      const std::size_t half{(mask + 1) / 2};
+      if (used <= half && used + n > half) {
+         drainer->notify();
+      }
+      return;
+   }
+
+   drainer->notify();
+   for (std::size_t i = 0; i < n; i++) {
+      while (h - tail.load(std::memory_order_acquire) > mask) {
+         // publish what is queued so far, then wait for room
+         head.store(h, std::memory_order_release);
+         std::this_thread::yield();
+      }
+      ring[h & mask] = values[i];
+      h++;
+   }
+   head.store(h, std::memory_order_release);
+}
+
+std::size_t TelemetryWriter::drain()
+{
+   const std::size_t t{tail.load(std::memory_order_relaxed)};
+   const std::size_t h{head.load(std::memory_order_acquire)};
+   if (h == t) {
+      return 0;
+   }
+
+   // at most two pieces, split where the ring wraps
+   const std::size_t n{h - t};
+   const std::size_t first{std::min(n, mask + 1 - (t & mask))};
+   std::fwrite(&ring[t & mask], sizeof(double), first, file);
+   if (first < n) {
+      std::fwrite(&ring[0], sizeof(double), n - first, file);
+   }
+   tail.store(h, std::memory_order_release);
+   return n;
+}
+}
+}
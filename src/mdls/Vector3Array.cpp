@@ -0,0 +1,37 @@
+
+#include "sflight/mdls/Vector3Array.hpp"
+
+#include "sflight/mdls/Vector3.hpp"
+
+namespace sflight {
+namespace mdls {
+
+void Vector3Array::resize(const std::size_t n)
+{
+   a1.resize(n);
+   a2.resize(n);
+   a3.resize(n);
+}
+
+void Vector3Array::push_back(const Vector3& v)
+{
+   a1.push_back(v.get1());
+   a2.push_back(v.get2());
+   a3.push_back(v.get3());
+}
+
+void Vector3Array::get(const std::size_t index, Vector3& v) const
+{
+   v.set1(a1[index]);
+   v.set2(a2[index]);
+   v.set3(a3[index]);
+}
+
+void Vector3Array::set(const std::size_t index, const Vector3& v)
+{
+   a1[index] = v.get1();
+   a2[index] = v.get2();
+   a3[index] = v.get3();
+}
+}
+}
@@ -0,0 +1,28 @@
+
+#include "sflight/mdls/batch/BatchAtmosphere.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+
+namespace sflight {
+namespace mdls {
+
+BatchAtmosphere::BatchAtmosphere(PlayerBatch* batch, const Atmosphere& prototype)
+    : BatchModule(batch, prototype), model(prototype.model)
+{
+}
+
+void BatchAtmosphere::update(const double timestep)
+{
+   Atmosphere::getAll(model, batch->size(), batch->alt.data(), nullptr, nullptr,
+                      batch->rho.data(), nullptr);
+}
+
+Atmosphere::Model BatchAtmosphere::getModel(const PlayerBatch& batch)
+{
+   const BatchAtmosphere* const atmosphere{batch.getAtmosphere()};
+   return atmosphere ? atmosphere->model : Atmosphere::Model::TABLE;
+}
+}
+}
@@ -0,0 +1,167 @@
+
+#include "sflight/mdls/batch/BatchAutoPilot.hpp"
+#include "sflight/mdls/batch/BatchAtmosphere.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/mdls/modules/AutoPilot.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/UnitConvert.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchAutoPilot::BatchAutoPilot(PlayerBatch* batch, const AutoPilot& prototype)
+    : BatchModule(batch, prototype), kphi(prototype.kphi), maxBankRate(prototype.maxBankRate),
+      kalt(prototype.kalt), kpitch(prototype.kpitch), maxG(prototype.maxG),
+      minG(prototype.minG), maxG_rate(prototype.maxG_rate), minG_rate(prototype.minG_rate),
+      maxThrottle(prototype.maxThrottle), minThrottle(prototype.minThrottle),
+      spoolTime(prototype.spoolTime),
+      trajectoryTurn(prototype.turnType == AutoPilot::TurnType::TRAJECTORY)
+{
+}
+
+void BatchAutoPilot::update(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+
+   // aircraft added after this module was created start from a level state
+   lastVz.resize(n);
+
+   for (std::size_t i = 0; i < n; i++) {
+      const AutoPilotCmds& cmds{b.autoPilotCmds[i]};
+
+      if (cmds.isAutoPilotOn()) {
+
+         // null rotational accel rates ( in case of previous manual control )
+         b.pqrdot.a1[i] *= 0;
+         b.pqrdot.a2[i] *= 0;
+         b.pqrdot.a3[i] *= 0;
+
+         if (cmds.isOrbitHoldOn()) {
+            updateHdg(i, timestep,
+                      b.eulers.a1[i] + math::PI / 2.0 * UnitConvert::signum(cmds.getMaxBank()));
+            updateAlt(i, timestep);
+         }
+
+         if (cmds.isAltHoldOn()) {
+            updateAlt(i, timestep);
+         } else if (cmds.isVsHoldOn()) {
+            updateVS(i, timestep, cmds.getCmdVertSpeed());
+         }
+
+         if (cmds.isHdgHoldOn()) {
+            updateHdg(i, timestep, cmds.getCmdHeading());
+         }
+      }
+
+      if (cmds.isAutoThrottleOn()) {
+         updateSpeed(i, timestep);
+      }
+   }
+}
+
+void BatchAutoPilot::updateHdg(const std::size_t i, const double timestep, const double cmdHdg)
+{
+   PlayerBatch& b{*batch};
+   const AutoPilotCmds& cmds{b.autoPilotCmds[i]};
+
+   double hdgDiff{};
+   if (trajectoryTurn) {
+      hdgDiff = cmdHdg - std::atan2(b.nedVel.a2[i], b.nedVel.a1[i]);
+   } else {
+      hdgDiff = cmdHdg - b.eulers.a1[i];
+   }
+
+   // if hdgDiff > 180, turn opp dir by making hdgDiff neg num <180
+   hdgDiff = UnitConvert::wrapHeading(hdgDiff, true);
+
+   double phiCmd = kphi * hdgDiff * b.vInf[i] * maxBankRate;
+   // bound phiCmd to -maxBank...maxBank
+   phiCmd = std::min(cmds.getMaxBank(), std::max(-cmds.getMaxBank(), phiCmd));
+
+   // bound pCmd to -maxBankRate...maxBankRate
+   const double pCmd = std::min(maxBankRate, std::max(-maxBankRate, phiCmd - b.eulers.a3[i]));
+
+   b.pqr.a1[i] = pCmd;
+}
+
+void BatchAutoPilot::updateAlt(const std::size_t i, const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const AutoPilotCmds& cmds{b.autoPilotCmds[i]};
+
+   double vscmd = kalt * (cmds.getCmdAltitude() - b.alt[i]);
+
+   vscmd = std::min(std::fabs(vscmd), cmds.getMaxVS()) * UnitConvert::signum(vscmd);
+
+   updateVS(i, timestep, vscmd);
+}
+
+void BatchAutoPilot::updateVS(const std::size_t i, const double timestep, const double cmdVs)
+{
+   PlayerBatch& b{*batch};
+   const AutoPilotCmds& cmds{b.autoPilotCmds[i]};
+
+   const double u = b.uvw.a1[i];
+   const double phi = b.eulers.a3[i];
+   const double theta = b.eulers.a2[i];
+   const double q = b.pqr.a2[i];
+   const double vz = b.nedVel.a3[i];
+
+   // see AutoPilot::updateVS, deltaVS = vInf * dTheta
+   double qCmd = (cmdVs + vz + kpitch * (vz - lastVz[i]) / timestep) / u;
+   lastVz[i] = vz;
+
+   // amount of q to compensate for turning
+   const double qTurn = b.pqr.a3[i] * std::tan(phi);
+
+   if (qCmd > 0) {
+      const double qLimit =
+          std::min((cmds.getMaxPitchUp() - theta) / cmds.getMaxPitchUp(), 1.0);
+      const double qMax = maxG / u * qLimit;
+      qCmd = std::min(qCmd, qMax);
+      qCmd = std::min(q + maxG_rate / u * timestep, qCmd);
+   } else {
+      const double qLimit =
+          std::min((cmds.getMaxPitchDown() - theta) / cmds.getMaxPitchDown(), 1.0);
+      const double qMin = minG / u * qLimit;
+      qCmd = std::max(qMin, qCmd);
+      qCmd = std::max(q - qTurn + minG_rate / u * timestep, qCmd);
+   }
+
+   // if in a turn, add in extra q to compensate for r pulling downward
+   qCmd += qTurn;
+
+   b.pqr.a2[i] = qCmd;
+}
+
+void BatchAutoPilot::updateSpeed(const std::size_t i, const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const AutoPilotCmds& cmds{b.autoPilotCmds[i]};
+
+   double cmdVel = cmds.getCmdSpeed();
+   if (cmds.isUsingMach()) {
+      cmdVel = cmds.getCmdMach() *
+               Atmosphere::getSpeedSound(BatchAtmosphere::getModel(b), b.alt[i]);
+   }
+
+   const double dV = (cmdVel - b.uvw.a1[i]) - b.uvwdot.a1[i] * spoolTime;
+   const double dT = timestep / spoolTime * dV;
+
+   double throttle = b.throttle[i] + dT;
+
+   if (throttle < minThrottle) {
+      throttle = minThrottle;
+   } else if (throttle > maxThrottle) {
+      throttle = maxThrottle;
+   }
+   b.throttle[i] = throttle;
+}
+}
+}
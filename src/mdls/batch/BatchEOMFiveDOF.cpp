@@ -0,0 +1,261 @@
+
+#include "sflight/mdls/batch/BatchEOMFiveDOF.hpp"
+#include "sflight/mdls/batch/BatchAtmosphere.hpp"
+#include "sflight/mdls/batch/eom_kernel.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/mdls/modules/EOMFiveDOF.hpp"
+
+#include "sflight/mdls/Euler.hpp"
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/Quaternion.hpp"
+#include "sflight/mdls/Vector3.hpp"
+
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchEOMFiveDOF::BatchEOMFiveDOF(PlayerBatch* batch, const EOMFiveDOF& prototype)
+    : BatchModule(batch, prototype), gravConst(prototype.gravConst),
+      autoRudder(prototype.autoRudder)
+{
+}
+
+void BatchEOMFiveDOF::setInstructionSet(const simd::InstructionSet x)
+{
+   const simd::InstructionSet max{simd::getInstructionSet()};
+   isa = x < max ? x : max;
+}
+
+void BatchEOMFiveDOF::update(const double timestep)
+{
+   if (isa == simd::InstructionSet::SCALAR) {
+      computeEOM(timestep);
+   } else {
+      computeEOMVector(timestep);
+   }
+}
+
+//
+// Same equations, in the same order, as EOMFiveDOF::computeEOM, so a batch
+// entry follows exactly the trajectory of the equivalent single Player.
+//
+void BatchEOMFiveDOF::computeEOM(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+   const Atmosphere::Model model{BatchAtmosphere::getModel(b)};
+
+   Quaternion quat;
+   Quaternion qdot;
+   Euler eulers;
+   Vector3 uvw;
+   Vector3 ned;
+   Vector3 gravAccel;
+
+   for (std::size_t i = 0; i < n; i++) {
+      // the attitude is carried from step to step, normalized
+      quat = Quaternion(b.qw[i], b.qx[i], b.qy[i], b.qz[i]);
+      const double theta{b.eulers.a2[i]};
+
+      double u{b.uvw.a1[i]};
+      double v{b.uvw.a2[i]};
+      double w{b.uvw.a3[i]};
+      double p{b.pqr.a1[i]};
+      double q{b.pqr.a2[i]};
+      double r{b.pqr.a3[i]};
+
+      // set the accel based on angular rates.
+      double udot{r * v - q * w};
+      double vdot{autoRudder ? 0 : -r * u + p * w};
+      double wdot{q * u - p * v};
+
+      // get gravity acceleration for current orientation
+      quat.getDown(gravAccel);
+      gravAccel.multiply(nav::getG(b.lat[i], b.lon[i], b.alt[i]));
+
+      // set the "g" term
+      b.g[i] = (wdot + gravAccel.get3()) / gravConst;
+
+      // add gravity accel to uvwdot
+      udot += gravAccel.get1();
+      vdot += gravAccel.get2();
+      wdot += gravAccel.get3();
+
+      // add aero and propulsion forces to uvwdot
+      const double invMass{1. / b.mass[i]};
+      udot += (b.aeroForce.a1[i] + b.thrust.a1[i]) * invMass;
+      vdot += (b.aeroForce.a2[i] + b.thrust.a2[i]) * invMass;
+      wdot += (b.aeroForce.a3[i] + b.thrust.a3[i]) * invMass;
+
+      // compute new velocity vector
+      u += udot * timestep;
+      v += vdot * timestep;
+      w += wdot * timestep;
+
+      // compute the new aero angles
+      const double vInf{std::sqrt(u * u + v * v + w * w)};
+      b.vInf[i] = vInf;
+      b.alpha[i] = std::atan2(w, u);
+      b.beta[i] = std::asin(v / vInf);
+      b.alphaDot[i] = std::atan2(wdot, u);
+      b.betaDot[i] = std::asin(vdot / vInf);
+
+      // adjust yaw rate to match change in beta (no-slip condition)
+      if (autoRudder) {
+         r = b.betaDot[i];
+         b.beta[i] = 0;
+         v = 0;
+      }
+
+      // test for on ground condition and prevent downward accel if true
+      if (b.altagl[i] < 0) {
+         if (theta < 0) {
+            q = q > 0 ? q : 0;
+         }
+         w = w < 0 ? w : 0;
+         wdot = wdot < 0 ? wdot : 0;
+      }
+
+      // integrate pqrdot and add to pqr
+      p += b.pqrdot.a1[i] * timestep;
+      q += b.pqrdot.a2[i] * timestep;
+      r += b.pqrdot.a3[i] * timestep;
+
+      // adjust the quaternion based on the body angular rates
+      quat.getQdot(qdot, p, q, r);
+      qdot.multiply(timestep);
+      quat.add(qdot);
+      quat.getEulers(eulers);
+
+      // compute the north, east, down velocities
+      uvw.set1(u);
+      uvw.set2(v);
+      uvw.set3(w);
+      quat.getDxDyDz(ned, uvw);
+
+      // add steady-state wind vel to air velocity
+      const double vn{ned.get1() + b.windVel.a1[i]};
+      const double ve{ned.get2() + b.windVel.a2[i]};
+      const double vd{ned.get3() + b.windVel.a3[i]};
+
+      // integrate velocities to get new lat, lon
+      nav::wgs84LatLon(&b.lat[i], &b.lon[i], b.alt[i], vn, ve, timestep);
+
+      // update the position in x-y-z space
+      b.xyz.a1[i] += vn * timestep;
+      b.xyz.a2[i] += ve * timestep;
+      b.xyz.a3[i] += vd * timestep;
+
+      // set the new alt (positive vel is downward)
+      b.alt[i] = b.alt[i] - vd * timestep;
+
+      // set the mach number
+      b.mach[i] = vInf / Atmosphere::getSpeedSound(model, b.alt[i]);
+
+      // store the new state
+      b.uvw.a1[i] = u;
+      b.uvw.a2[i] = v;
+      b.uvw.a3[i] = w;
+      b.uvwdot.a1[i] = udot;
+      b.uvwdot.a2[i] = vdot;
+      b.uvwdot.a3[i] = wdot;
+      b.pqr.a1[i] = p;
+      b.pqr.a2[i] = q;
+      b.pqr.a3[i] = r;
+      b.qw[i] = quat.getEo();
+      b.qx[i] = quat.getEx();
+      b.qy[i] = quat.getEy();
+      b.qz[i] = quat.getEz();
+      b.eulers.a1[i] = eulers.getPsi();
+      b.eulers.a2[i] = eulers.getTheta();
+      b.eulers.a3[i] = eulers.getPhi();
+      b.nedVel.a1[i] = vn;
+      b.nedVel.a2[i] = ve;
+      b.nedVel.a3[i] = vd;
+   }
+}
+void BatchEOMFiveDOF::computeEOMVector(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+
+   simd::EOMLanes lanes;
+   double** f{lanes.field};
+   f[simd::LAT] = b.lat.data();
+   f[simd::LON] = b.lon.data();
+   f[simd::ALT] = b.alt.data();
+   f[simd::MASS] = b.mass.data();
+   f[simd::ALTAGL] = b.altagl.data();
+   f[simd::G] = b.g.data();
+   f[simd::VINF] = b.vInf.data();
+   f[simd::ALPHA] = b.alpha.data();
+   f[simd::BETA] = b.beta.data();
+   f[simd::ALPHADOT] = b.alphaDot.data();
+   f[simd::BETADOT] = b.betaDot.data();
+   f[simd::U] = b.uvw.a1.data();
+   f[simd::V] = b.uvw.a2.data();
+   f[simd::W] = b.uvw.a3.data();
+   f[simd::UDOT] = b.uvwdot.a1.data();
+   f[simd::VDOT] = b.uvwdot.a2.data();
+   f[simd::WDOT] = b.uvwdot.a3.data();
+   f[simd::P] = b.pqr.a1.data();
+   f[simd::Q] = b.pqr.a2.data();
+   f[simd::R] = b.pqr.a3.data();
+   f[simd::PDOT] = b.pqrdot.a1.data();
+   f[simd::QDOT] = b.pqrdot.a2.data();
+   f[simd::RDOT] = b.pqrdot.a3.data();
+   f[simd::PSI] = b.eulers.a1.data();
+   f[simd::THETA] = b.eulers.a2.data();
+   f[simd::PHI] = b.eulers.a3.data();
+   f[simd::QW] = b.qw.data();
+   f[simd::QX] = b.qx.data();
+   f[simd::QY] = b.qy.data();
+   f[simd::QZ] = b.qz.data();
+   f[simd::AERO_X] = b.aeroForce.a1.data();
+   f[simd::AERO_Y] = b.aeroForce.a2.data();
+   f[simd::AERO_Z] = b.aeroForce.a3.data();
+   f[simd::THRUST_X] = b.thrust.a1.data();
+   f[simd::THRUST_Y] = b.thrust.a2.data();
+   f[simd::THRUST_Z] = b.thrust.a3.data();
+   f[simd::WIND_N] = b.windVel.a1.data();
+   f[simd::WIND_E] = b.windVel.a2.data();
+   f[simd::WIND_D] = b.windVel.a3.data();
+   f[simd::VN] = b.nedVel.a1.data();
+   f[simd::VE] = b.nedVel.a2.data();
+   f[simd::VD] = b.nedVel.a3.data();
+   f[simd::X] = b.xyz.a1.data();
+   f[simd::Y] = b.xyz.a2.data();
+   f[simd::Z] = b.xyz.a3.data();
+
+   simd::EOMParams params;
+   params.timestep = timestep;
+   params.grav = nav::getG(0, 0, 0);
+   params.gravConst = gravConst;
+   params.autoRudder = autoRudder;
+
+   switch (isa) {
+   case simd::InstructionSet::AVX512:
+      simd::eomKernelAVX512(lanes, n, params);
+      break;
+   case simd::InstructionSet::AVX2:
+      simd::eomKernelAVX2(lanes, n, params);
+      break;
+   default:
+      simd::eomKernelSSE2(lanes, n, params);
+      break;
+   }
+
+   // set the mach number
+   speedSound.resize(n);
+   Atmosphere::getAll(BatchAtmosphere::getModel(b), n, b.alt.data(), nullptr, nullptr, nullptr,
+                      speedSound.data());
+   for (std::size_t i = 0; i < n; i++) {
+      b.mach[i] = b.vInf[i] / speedSound[i];
+   }
+}
+}
+}
@@ -0,0 +1,54 @@
+
+#include "sflight/mdls/batch/BatchEngine.hpp"
+#include "sflight/mdls/batch/BatchAtmosphere.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/mdls/modules/Engine.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchEngine::BatchEngine(PlayerBatch* batch, const Engine& prototype)
+    : BatchModule(batch, prototype), thrustAngle(prototype.thrustAngle),
+      seaLevelTemp(prototype.seaLevelTemp), seaLevelPress(prototype.seaLevelPress),
+      staticThrust(prototype.staticThrust), staticFF(prototype.staticFF)
+{
+}
+
+void BatchEngine::update(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+   const Atmosphere::Model model{BatchAtmosphere::getModel(b)};
+
+   for (std::size_t i = 0; i < n; i++) {
+      if (b.fuel[i] <= 0) {
+         b.thrust.a1[i] = 0;
+         b.thrust.a2[i] = 0;
+         b.thrust.a3[i] = 0;
+         continue;
+      }
+
+      const AtmosphereData atmos{Atmosphere::getAll(model, b.alt[i])};
+      const double airRatio = atmos.temp * atmos.pressure / seaLevelTemp / seaLevelPress;
+
+      b.rpm[i] = b.throttle[i];
+
+      const double thrust = b.rpm[i] * staticThrust * airRatio * b.mach[i];
+
+      b.thrust.a1[i] = thrust * std::cos(thrustAngle);
+      b.thrust.a2[i] = 0;
+      b.thrust.a3[i] = -thrust * std::sin(thrustAngle);
+
+      b.fuelflow[i] = b.rpm[i] * staticFF * airRatio;
+
+      b.fuel[i] -= b.fuelflow[i] * timestep;
+      b.mass[i] -= b.fuelflow[i] * timestep;
+   }
+}
+}
+}
@@ -0,0 +1,87 @@
+
+#include "sflight/mdls/batch/BatchFileOutput.hpp"
+
+#include "sflight/mdls/modules/FileOutput.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+
+namespace sflight {
+namespace mdls {
+
+BatchFileOutput::BatchFileOutput(PlayerBatch* batch, const FileOutput& prototype)
+    : BatchModule(batch, prototype), filename(prototype.filename),
+      channels(prototype.channels), rate(prototype.rate), outputTime(prototype.lastTime)
+{
+}
+
+void BatchFileOutput::update(const double)
+{
+   if (!opened) {
+      open();
+   }
+   if (batch->simTime - outputTime > 1.0 / rate) {
+      update();
+      outputTime = batch->simTime;
+   }
+}
+
+void BatchFileOutput::open()
+{
+   opened = true;
+   row.resize(channels.size());
+   fout.open(filename.c_str());
+   if (fout.is_open()) {
+      writeTextHeader(fout, channels);
+      fout << std::endl;
+   }
+}
+
+void BatchFileOutput::update()
+{
+   // frameCounter counts output frames, for decimation
+   const std::size_t frame{static_cast<std::size_t>(frameCounter++)};
+
+   if (!fout.is_open()) {
+      return;
+   }
+
+   // the channels are read straight from the batch arrays, found again each
+   // frame as they move when aircraft are added
+   const std::size_t numChannels{channels.size()};
+   sources.resize(numChannels);
+   strides.resize(numChannels);
+   std::size_t numHeld{};
+   for (std::size_t i = 0; i < numChannels; i++) {
+      sources[i] = batch->getField(channels.getField(i).offset, &strides[i]);
+      if (channels.getDecimation(i) > 1) {
+         numHeld++;
+      }
+   }
+   const std::size_t n{batch->size()};
+   held.resize(n * numHeld);
+
+   for (std::size_t j = 0; j < n; j++) {
+      double* const last{held.data() + j * numHeld};
+      std::size_t k{};
+      for (std::size_t i = 0; i < numChannels; i++) {
+         const std::size_t decimation{channels.getDecimation(i)};
+         const bool due{frame % decimation == 0};
+         if (due) {
+            row[i] = sources[i] != nullptr ? sources[i][j * strides[i]] : 0;
+         }
+         if (decimation > 1) {
+            if (due) {
+               last[k] = row[i];
+            } else {
+               row[i] = last[k];
+            }
+            k++;
+         }
+      }
+      writeText(fout, channels, row.data());
+      fout << '\n';
+   }
+   fout.flush();
+}
+}
+}
@@ -0,0 +1,64 @@
+
+#include "sflight/mdls/batch/BatchInterpAero.hpp"
+
+#include "sflight/mdls/modules/InterpAero.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/Vector3.hpp"
+#include "sflight/mdls/WindAxis.hpp"
+
+namespace sflight {
+namespace mdls {
+
+BatchInterpAero::BatchInterpAero(PlayerBatch* batch, const InterpAero& prototype)
+    : BatchModule(batch, prototype), wingArea(prototype.wingArea), a1(prototype.a1),
+      a2(prototype.a2), b1(prototype.b1), b2(prototype.b2),
+      usingMachEffects(prototype.usingMachEffects), wingSpan(prototype.wingSpan),
+      cruiseAlpha(prototype.cruiseAlpha), hasMoments(prototype.hasMoments),
+      chord(prototype.chord), clBeta(prototype.clBeta), clP(prototype.clP),
+      clAileron(prototype.clAileron), cmAlpha(prototype.cmAlpha), cmQ(prototype.cmQ),
+      cmElevator(prototype.cmElevator), cnBeta(prototype.cnBeta), cnR(prototype.cnR),
+      cnRudder(prototype.cnRudder)
+{
+}
+
+void BatchInterpAero::update(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+
+   Vector3 aeroForce;
+
+   for (std::size_t i = 0; i < n; i++) {
+      const double qbar = 0.5 * b.vInf[i] * b.vInf[i] * b.rho[i] * wingArea;
+
+      double cl = a1 + a2 * b.alpha[i];
+      double cd = b1 + b2 * cl * cl;
+      const double cy = -2.0 * b.beta[i];
+
+      if (usingMachEffects) {
+         const double beta_mach = InterpAero::getBetaMach(b.mach[i]);
+         cl /= beta_mach;
+         cd /= beta_mach;
+      }
+
+      WindAxis::windToBody(aeroForce, b.alpha[i], b.beta[i], cl * qbar, cd * qbar, cy * qbar);
+      b.aeroForce.set(i, aeroForce);
+
+      if (hasMoments) {
+         const double spanRate = wingSpan / (2.0 * b.vInf[i]);
+         const double chordRate = chord / (2.0 * b.vInf[i]);
+         b.aeroMoment.a1[i] = qbar * wingSpan *
+                              (clBeta * b.beta[i] + clP * b.pqr.a1[i] * spanRate +
+                               clAileron * b.deflections.a1[i]);
+         b.aeroMoment.a2[i] = qbar * chord *
+                              (cmAlpha * (b.alpha[i] - cruiseAlpha) +
+                               cmQ * b.pqr.a2[i] * chordRate + cmElevator * b.deflections.a2[i]);
+         b.aeroMoment.a3[i] = qbar * wingSpan *
+                              (cnBeta * b.beta[i] + cnR * b.pqr.a3[i] * spanRate +
+                               cnRudder * b.deflections.a3[i]);
+      }
+   }
+}
+}
+}
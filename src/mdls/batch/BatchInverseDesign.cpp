@@ -0,0 +1,70 @@
+
+#include "sflight/mdls/batch/BatchInverseDesign.hpp"
+
+#include "sflight/mdls/modules/InverseDesign.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/Vector3.hpp"
+#include "sflight/mdls/WindAxis.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchInverseDesign::BatchInverseDesign(PlayerBatch* batch, const InverseDesign& prototype)
+    : BatchModule(batch, prototype), wingArea(prototype.wingArea),
+      staticThrust(prototype.staticThrust), staticTSFC(prototype.staticTSFC),
+      thrustAngle(prototype.thrustAngle), dTdM(prototype.dTdM), dTdRho(prototype.dTdRho),
+      dTSFCdM(prototype.dTSFCdM), cdo(prototype.cdo), clo(prototype.clo), a(prototype.a),
+      b(prototype.b), usingMachEffects(prototype.usingMachEffects)
+{
+}
+
+void BatchInverseDesign::update(const double timestep)
+{
+   PlayerBatch& pb{*batch};
+   const std::size_t n{pb.size()};
+
+   const double cosThrust{std::cos(thrustAngle)};
+   const double sinThrust{std::sin(thrustAngle)};
+
+   Vector3 aeroForce;
+
+   for (std::size_t i = 0; i < n; i++) {
+      const double alpha{pb.alpha[i]};
+      const double mach{pb.mach[i]};
+      const double rho{pb.rho[i]};
+
+      const double qbar = 0.5 * pb.vInf[i] * pb.vInf[i] * rho * wingArea;
+
+      const double sinAlpha = std::sin(alpha);
+
+      double cl = clo + a * sinAlpha * std::cos(alpha);
+      double cd = cdo + b * sinAlpha * sinAlpha;
+
+      if (usingMachEffects) {
+         const double beta_mach = mach > 0.95 ? 1.0 : 1.0 / std::sqrt(1.0 - mach * mach);
+         cl *= beta_mach;
+         cd *= beta_mach;
+      }
+
+      WindAxis::windToBody(aeroForce, alpha, pb.beta[i], cl * qbar, cd * qbar, 0.0);
+      pb.aeroForce.set(i, aeroForce);
+
+      // see InverseDesign::getThrust and InverseDesign::getFuelFlow
+      const double thrust =
+          std::pow(mach, dTdM) * std::pow(rho / 1.225, dTdRho) * staticThrust * pb.throttle[i];
+
+      pb.thrust.a1[i] = thrust * cosThrust;
+      pb.thrust.a2[i] = 0;
+      pb.thrust.a3[i] = -thrust * sinThrust;
+
+      const double fuelflow = (staticTSFC + dTSFCdM * mach) * thrust;
+      pb.fuelflow[i] = fuelflow;
+      pb.mass[i] -= fuelflow * timestep;
+      pb.fuel[i] -= fuelflow * timestep;
+   }
+}
+}
+}
@@ -0,0 +1,14 @@
+
+#include "sflight/mdls/batch/BatchModule.hpp"
+
+#include "sflight/mdls/modules/Module.hpp"
+
+namespace sflight {
+namespace mdls {
+
+BatchModule::BatchModule(PlayerBatch* b, const Module& prototype)
+    : batch(b), frameTime(prototype.frameTime)
+{
+}
+}
+}
@@ -0,0 +1,48 @@
+
+#include "sflight/mdls/batch/BatchStickControl.hpp"
+
+#include "sflight/mdls/modules/StickControl.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchStickControl::BatchStickControl(PlayerBatch* batch, const StickControl& prototype)
+    : BatchModule(batch, prototype), designQbar(prototype.designQbar),
+      elevGain(prototype.elevGain), rudGain(prototype.rudGain), ailGain(prototype.ailGain),
+      pitchGain(prototype.pitchGain)
+{
+}
+
+void BatchStickControl::update(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+
+   for (std::size_t i = 0; i < n; i++) {
+      if (b.autoPilotCmds[i].isAutoPilotOn())
+         continue;
+
+      const double qbar = 0.5 * b.vInf[i] * b.vInf[i] * b.rho[i];
+
+      double qRatio = 0.0;
+      if (designQbar > 0) {
+         qRatio = qbar / designQbar * std::cos(b.alpha[i]);
+      }
+
+      const double theta{b.eulers.a2[i]};
+      const double phi{b.eulers.a3[i]};
+
+      const double pitchMom = (1.0 - qRatio) * pitchGain * std::cos(theta) * std::cos(phi);
+      const double yawMom = (1.0 - qRatio) * pitchGain * std::cos(theta) * std::sin(phi);
+
+      b.pqrdot.a1[i] = b.deflections.a2[i] * ailGain * qRatio - b.pqr.a1[i];
+      b.pqrdot.a2[i] = b.deflections.a1[i] * elevGain * qRatio + pitchMom - b.pqr.a2[i];
+      b.pqrdot.a3[i] = b.deflections.a3[i] * rudGain * qRatio - yawMom - b.pqr.a3[i];
+   }
+}
+}
+}
@@ -0,0 +1,60 @@
+
+#include "sflight/mdls/batch/BatchTableAero.hpp"
+
+#include "sflight/mdls/modules/TableAero.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/Vector3.hpp"
+#include "sflight/mdls/WindAxis.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchTableAero::BatchTableAero(PlayerBatch* batch, const TableAero& prototype)
+    : BatchModule(batch, prototype), wingArea(prototype.wingArea),
+      thrustAngle(prototype.thrustAngle), liftTable(prototype.liftTable),
+      dragTable(prototype.dragTable), thrustTable(prototype.thrustTable),
+      fuelflowTable(prototype.fuelflowTable)
+{
+}
+
+void BatchTableAero::update(const double timestep)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+
+   cl.resize(n);
+   cd.resize(n);
+   thrust.resize(n);
+
+   const double* lift[3]{b.mach.data(), b.alt.data(), b.alpha.data()};
+   liftTable->interpBatch(lift, cl.data(), n);
+   const double* drag[3]{b.mach.data(), b.alt.data(), cl.data()};
+   dragTable->interpBatch(drag, cd.data(), n);
+
+   Vector3 aeroForce;
+   for (std::size_t i = 0; i < n; i++) {
+      const double qbarS = 0.5 * b.vInf[i] * b.vInf[i] * b.rho[i] * wingArea;
+      WindAxis::windToBody(aeroForce, b.alpha[i], b.beta[i], cl[i] * qbarS, cd[i] * qbarS, 0);
+      b.aeroForce.set(i, aeroForce);
+   }
+
+   const double* engine[3]{b.throttle.data(), b.alt.data(), b.mach.data()};
+   fuelflowTable->interpBatch(engine, b.fuelflow.data(), n);
+   thrustTable->interpBatch(engine, thrust.data(), n);
+
+   const double cosAngle{std::cos(thrustAngle)};
+   const double sinAngle{std::sin(thrustAngle)};
+   for (std::size_t i = 0; i < n; i++) {
+      b.fuel[i] = b.fuel[i] - b.fuelflow[i] * timestep;
+      b.mass[i] = b.mass[i] - b.fuelflow[i] * timestep;
+
+      b.thrust.a1[i] = thrust[i] * cosAngle;
+      b.thrust.a2[i] = 0;
+      b.thrust.a3[i] = -thrust[i] * sinAngle;
+   }
+}
+}
+}
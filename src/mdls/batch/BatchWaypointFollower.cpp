@@ -0,0 +1,100 @@
+
+#include "sflight/mdls/batch/BatchWaypointFollower.hpp"
+
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/UnitConvert.hpp"
+#include "sflight/mdls/constants.hpp"
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+BatchWaypointFollower::BatchWaypointFollower(PlayerBatch* batch,
+                                             const WaypointFollower& prototype)
+    : BatchModule(batch, prototype), waypoints(prototype.waypoints),
+      bearing(prototype.cmdPathType == WaypointFollower::PathType::BEARING),
+      startWp(prototype.currentWp == nullptr
+                  ? none
+                  : static_cast<std::size_t>(prototype.currentWp - prototype.waypoints.data())),
+      startWpNum(prototype.wpNum), startDistTol(prototype.distTol), startOn(prototype.isOn)
+{
+}
+
+void BatchWaypointFollower::update(const double)
+{
+   PlayerBatch& b{*batch};
+   const std::size_t n{b.size()};
+
+   currentWp.resize(n, startWp);
+   wpNum.resize(n, startWpNum);
+   distTol.resize(n, startDistTol);
+   isOn.resize(n, startOn);
+
+   for (std::size_t i = 0; i < n; i++) {
+      if (!isOn[i])
+         continue;
+
+      if (currentWp[i] == none) {
+         loadWaypoint(i);
+         continue;
+      }
+      const Waypoint& wp{waypoints[currentWp[i]]};
+
+      const double az = nav::headingBetween(b.lat[i], b.lon[i], wp.radLat, wp.radLon);
+      const double dist = nav::distance(b.lat[i], b.lon[i], wp.radLat, wp.radLon);
+
+      const double hdg = std::atan2(b.nedVel.a2[i], b.nedVel.a1[i]);
+      const double hdgDiff = std::fabs(UnitConvert::wrapHeading(hdg - az, true));
+
+      const bool isClose = dist < distTol[i];
+      const bool isBehind = std::fabs(hdgDiff) > math::PI / 2.0;
+
+      if (isClose && isBehind) {
+         loadWaypoint(i);
+         continue;
+      }
+
+      if (!bearing || hdgDiff >= math::PI) {
+         b.autoPilotCmds[i].setCmdHeading(az);
+      } else {
+         b.autoPilotCmds[i].setCmdHeading(
+             UnitConvert::wrapHeading(2 * az - wp.radHeading - 0.01, true));
+      }
+   }
+}
+
+void BatchWaypointFollower::loadWaypoint(const std::size_t index)
+{
+   currentWp[index] = none;
+
+   if (waypoints.size() > wpNum[index]) {
+      setState(index, true);
+      currentWp[index] = wpNum[index];
+      const Waypoint& wp{waypoints[currentWp[index]]};
+      batch->autoPilotCmds[index].setCmdAltitude(wp.meterAlt);
+      batch->autoPilotCmds[index].setCmdSpeed(wp.mpsSpeed);
+
+      // set the distance tolerance to x seconds of flight time
+      distTol[index] = (wp.mpsSpeed * 5) * nav::metersToRadian;
+
+      wpNum[index]++;
+   } else {
+      setState(index, false);
+   }
+}
+
+void BatchWaypointFollower::setState(const std::size_t index, const bool x)
+{
+   if (x) {
+      AutoPilotCmds& cmds{batch->autoPilotCmds[index]};
+      cmds.setAltHoldOn(x);
+      cmds.setHdgHoldOn(x);
+      cmds.setAutoPilotOn(x);
+      cmds.setAutoThrottleOn(x);
+   }
+   isOn[index] = x;
+}
+}
+}
@@ -0,0 +1,106 @@
+
+#include "sflight/mdls/batch/eom_kernel.hpp"
+#include "sflight/mdls/simd.hpp"
+
+#include <cstdlib>
+
+#ifdef SFLIGHT_SIMD_X86
+
+// only this file is built for AVX2; it is called after a runtime cpu check
+#if defined(__GNUC__)
+#pragma GCC target("avx2")
+#endif
+
+#include "sflight/mdls/batch/eom_kernel_impl.hpp"
+
+#include <immintrin.h>
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+namespace {
+
+//------------------------------------------------------------------------------
+// Class: Mask4d
+// Description: Result of a comparison of two Vec4d; all bits set where true
+//------------------------------------------------------------------------------
+class Mask4d
+{
+ public:
+   __m256d m;
+};
+
+inline Mask4d operator&(const Mask4d a, const Mask4d b) { return {_mm256_and_pd(a.m, b.m)}; }
+inline Mask4d operator|(const Mask4d a, const Mask4d b) { return {_mm256_or_pd(a.m, b.m)}; }
+inline Mask4d operator^(const Mask4d a, const Mask4d b) { return {_mm256_xor_pd(a.m, b.m)}; }
+
+//------------------------------------------------------------------------------
+// Class: Vec4d
+// Description: Four packed doubles
+//------------------------------------------------------------------------------
+class Vec4d
+{
+ public:
+   static const std::size_t width{4};
+
+   Vec4d() = default;
+   Vec4d(const __m256d x) : v(x) {}
+   Vec4d(const double x) : v(_mm256_set1_pd(x)) {}
+
+   static Vec4d load(const double* const p) { return _mm256_loadu_pd(p); }
+   void store(double* const p) const { _mm256_storeu_pd(p, v); }
+
+   __m256d v;
+};
+
+inline Vec4d operator+(const Vec4d a, const Vec4d b) { return _mm256_add_pd(a.v, b.v); }
+inline Vec4d operator-(const Vec4d a, const Vec4d b) { return _mm256_sub_pd(a.v, b.v); }
+inline Vec4d operator*(const Vec4d a, const Vec4d b) { return _mm256_mul_pd(a.v, b.v); }
+inline Vec4d operator/(const Vec4d a, const Vec4d b) { return _mm256_div_pd(a.v, b.v); }
+
+inline Mask4d operator<(const Vec4d a, const Vec4d b)
+{
+   return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask4d operator>(const Vec4d a, const Vec4d b)
+{
+   return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask4d operator==(const Vec4d a, const Vec4d b)
+{
+   return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+inline Vec4d select(const Mask4d m, const Vec4d a, const Vec4d b)
+{
+   return _mm256_blendv_pd(b.v, a.v, m.m);
+}
+
+inline Vec4d sqrt(const Vec4d a) { return _mm256_sqrt_pd(a.v); }
+
+inline Vec4d abs(const Vec4d a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v); }
+
+inline Vec4d floor(const Vec4d a) { return _mm256_floor_pd(a.v); }
+}
+
+void eomKernelAVX2(const EOMLanes& lanes, const std::size_t n, const EOMParams& params)
+{
+   runEOMKernel<Vec4d>(lanes, n, params);
+}
+}
+}
+}
+
+#else
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+// never selected by getInstructionSet() on this platform
+void eomKernelAVX2(const EOMLanes&, const std::size_t, const EOMParams&) { std::abort(); }
+}
+}
+}
+
+#endif
@@ -0,0 +1,111 @@
+
+#include "sflight/mdls/batch/eom_kernel.hpp"
+#include "sflight/mdls/simd.hpp"
+
+#include <cstdlib>
+
+#ifdef SFLIGHT_SIMD_X86
+
+// only this file is built for AVX-512; it is called after a runtime cpu check
+#if defined(__GNUC__)
+#pragma GCC target("avx512f")
+#endif
+
+#include "sflight/mdls/batch/eom_kernel_impl.hpp"
+
+#include <immintrin.h>
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+namespace {
+
+//------------------------------------------------------------------------------
+// Class: Mask8d
+// Description: Result of a comparison of two Vec8d; one bit per lane
+//------------------------------------------------------------------------------
+class Mask8d
+{
+ public:
+   __mmask8 m;
+};
+
+inline Mask8d operator&(const Mask8d a, const Mask8d b) { return {__mmask8(a.m & b.m)}; }
+inline Mask8d operator|(const Mask8d a, const Mask8d b) { return {__mmask8(a.m | b.m)}; }
+inline Mask8d operator^(const Mask8d a, const Mask8d b) { return {__mmask8(a.m ^ b.m)}; }
+
+//------------------------------------------------------------------------------
+// Class: Vec8d
+// Description: Eight packed doubles
+//------------------------------------------------------------------------------
+class Vec8d
+{
+ public:
+   static const std::size_t width{8};
+
+   Vec8d() = default;
+   Vec8d(const __m512d x) : v(x) {}
+   Vec8d(const double x) : v(_mm512_set1_pd(x)) {}
+
+   static Vec8d load(const double* const p) { return _mm512_loadu_pd(p); }
+   void store(double* const p) const { _mm512_storeu_pd(p, v); }
+
+   __m512d v;
+};
+
+inline Vec8d operator+(const Vec8d a, const Vec8d b) { return _mm512_add_pd(a.v, b.v); }
+inline Vec8d operator-(const Vec8d a, const Vec8d b) { return _mm512_sub_pd(a.v, b.v); }
+inline Vec8d operator*(const Vec8d a, const Vec8d b) { return _mm512_mul_pd(a.v, b.v); }
+inline Vec8d operator/(const Vec8d a, const Vec8d b) { return _mm512_div_pd(a.v, b.v); }
+
+inline Mask8d operator<(const Vec8d a, const Vec8d b)
+{
+   return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask8d operator>(const Vec8d a, const Vec8d b)
+{
+   return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask8d operator==(const Vec8d a, const Vec8d b)
+{
+   return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ)};
+}
+
+inline Vec8d select(const Mask8d m, const Vec8d a, const Vec8d b)
+{
+   return _mm512_mask_blend_pd(m.m, b.v, a.v);
+}
+
+// sqrt and floor use the masked forms, every lane selected, so no source lane
+// is left undefined
+inline Vec8d sqrt(const Vec8d a) { return _mm512_mask_sqrt_pd(a.v, 0xff, a.v); }
+
+inline Vec8d abs(const Vec8d a) { return _mm512_abs_pd(a.v); }
+
+inline Vec8d floor(const Vec8d a)
+{
+   return _mm512_mask_roundscale_pd(a.v, 0xff, a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+}
+
+void eomKernelAVX512(const EOMLanes& lanes, const std::size_t n, const EOMParams& params)
+{
+   runEOMKernel<Vec8d>(lanes, n, params);
+}
+}
+}
+}
+
+#else
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+// never selected by getInstructionSet() on this platform
+void eomKernelAVX512(const EOMLanes&, const std::size_t, const EOMParams&) { std::abort(); }
+}
+}
+}
+
+#endif
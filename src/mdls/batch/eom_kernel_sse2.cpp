@@ -0,0 +1,98 @@
+
+#include "sflight/mdls/batch/eom_kernel.hpp"
+#include "sflight/mdls/simd.hpp"
+
+#include <cstdlib>
+
+#ifdef SFLIGHT_SIMD_X86
+
+#include "sflight/mdls/batch/eom_kernel_impl.hpp"
+
+#include <emmintrin.h>
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+namespace {
+
+//------------------------------------------------------------------------------
+// Class: Mask2d
+// Description: Result of a comparison of two Vec2d; all bits set where true
+//------------------------------------------------------------------------------
+class Mask2d
+{
+ public:
+   __m128d m;
+};
+
+inline Mask2d operator&(const Mask2d a, const Mask2d b) { return {_mm_and_pd(a.m, b.m)}; }
+inline Mask2d operator|(const Mask2d a, const Mask2d b) { return {_mm_or_pd(a.m, b.m)}; }
+inline Mask2d operator^(const Mask2d a, const Mask2d b) { return {_mm_xor_pd(a.m, b.m)}; }
+
+//------------------------------------------------------------------------------
+// Class: Vec2d
+// Description: Two packed doubles
+//------------------------------------------------------------------------------
+class Vec2d
+{
+ public:
+   static const std::size_t width{2};
+
+   Vec2d() = default;
+   Vec2d(const __m128d x) : v(x) {}
+   Vec2d(const double x) : v(_mm_set1_pd(x)) {}
+
+   static Vec2d load(const double* const p) { return _mm_loadu_pd(p); }
+   void store(double* const p) const { _mm_storeu_pd(p, v); }
+
+   __m128d v;
+};
+
+inline Vec2d operator+(const Vec2d a, const Vec2d b) { return _mm_add_pd(a.v, b.v); }
+inline Vec2d operator-(const Vec2d a, const Vec2d b) { return _mm_sub_pd(a.v, b.v); }
+inline Vec2d operator*(const Vec2d a, const Vec2d b) { return _mm_mul_pd(a.v, b.v); }
+inline Vec2d operator/(const Vec2d a, const Vec2d b) { return _mm_div_pd(a.v, b.v); }
+
+inline Mask2d operator<(const Vec2d a, const Vec2d b) { return {_mm_cmplt_pd(a.v, b.v)}; }
+inline Mask2d operator>(const Vec2d a, const Vec2d b) { return {_mm_cmpgt_pd(a.v, b.v)}; }
+inline Mask2d operator==(const Vec2d a, const Vec2d b) { return {_mm_cmpeq_pd(a.v, b.v)}; }
+
+inline Vec2d select(const Mask2d m, const Vec2d a, const Vec2d b)
+{
+   return _mm_or_pd(_mm_and_pd(m.m, a.v), _mm_andnot_pd(m.m, b.v));
+}
+
+inline Vec2d sqrt(const Vec2d a) { return _mm_sqrt_pd(a.v); }
+
+inline Vec2d abs(const Vec2d a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a.v); }
+
+// sse2 has no rounding instruction; truncate through int32 and step down where
+// that rounded a negative value up (all arguments here are well within range)
+inline Vec2d floor(const Vec2d a)
+{
+   const Vec2d t{_mm_cvtepi32_pd(_mm_cvttpd_epi32(a.v))};
+   return t - select(a < t, Vec2d(1.0), Vec2d(0.0));
+}
+}
+
+void eomKernelSSE2(const EOMLanes& lanes, const std::size_t n, const EOMParams& params)
+{
+   runEOMKernel<Vec2d>(lanes, n, params);
+}
+}
+}
+}
+
+#else
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+// never selected by getInstructionSet() on this platform
+void eomKernelSSE2(const EOMLanes&, const std::size_t, const EOMParams&) { std::abort(); }
+}
+}
+}
+
+#endif
@@ -36,20 +36,33 @@ Atmosphere::Atmosphere(Player* player, const double frameRate)
 
 void Atmosphere::update(const double timestep)
 {
-   player->rho = getRho(player->alt);
+   if (model == Model::ISA) {
+      player->rho = getAllISA(player->alt).rho;
+   } else {
+      player->rho = getRho(player->alt);
+   }
 }
 
+//
+// The table rows are 1000 m apart, so the index is computed directly; the
+// check against the neighbouring rows covers rounding in the division.  This
+// selects the same row as a scan for the first alt[] above metersAlt, capped
+// at maxIndex - 2.
+//
 int Atmosphere::getIndex(const double metersAlt)
 {
    if (metersAlt < 0)
       return 0;
 
-   int index {};
-   for (index = 1; index < maxIndex - 1; index++) {
-      if (alt[index] > metersAlt)
-         return index - 1;
+   const int last{maxIndex - 2};
+   const double row{std::floor(metersAlt / 1000.0)};
+   int index{row < last ? static_cast<int>(row) : last};
+   if (index > 0 && alt[index] > metersAlt) {
+      index--;
+   } else if (index < last && alt[index + 1] <= metersAlt) {
+      index++;
    }
-   return index - 1;
+   return index;
 }
 
 double Atmosphere::getRemainder(const double alt)
@@ -101,5 +114,150 @@ double Atmosphere::getSpeedSound(const double tempK)
 {
    return std::sqrt(1.4 * 287.01 * tempK);
 }
+
+AtmosphereData Atmosphere::getAll(const double alt_meters)
+{
+   const int index{getIndex(alt_meters)};
+   const double remainder{getRemainder(alt_meters)};
+
+   AtmosphereData x;
+   x.temp = temp[index] + (temp[index + 1] - temp[index]) * remainder + 273.15;
+   x.pressure = press[index] + (press[index + 1] - press[index]) * remainder;
+   x.rho = dens[index] + (dens[index + 1] - dens[index]) * remainder;
+   x.speedSound = getSpeedSound(x.temp);
+   return x;
+}
+
+//
+// Rows and remainders for a block of altitudes are found first, then each
+// requested property is interpolated in its own loop.
+//
+void Atmosphere::getAll(const std::size_t n, const double alt_meters[], double temp[],
+                        double pressure[], double rho[], double speedSound[])
+{
+   const std::size_t blockSize{64};
+   int index[blockSize];
+   double remainder[blockSize];
+   double t[blockSize];
+
+   for (std::size_t start = 0; start < n; start += blockSize) {
+      const std::size_t m{n - start < blockSize ? n - start : blockSize};
+      const double* const a{alt_meters + start};
+
+      for (std::size_t j = 0; j < m; j++) {
+         index[j] = getIndex(a[j]);
+         remainder[j] = getRemainder(a[j]);
+      }
+
+      if (temp || speedSound) {
+         for (std::size_t j = 0; j < m; j++) {
+            const int k{index[j]};
+            t[j] = Atmosphere::temp[k] + (Atmosphere::temp[k + 1] - Atmosphere::temp[k]) *
+                                             remainder[j] + 273.15;
+         }
+         if (temp) {
+            for (std::size_t j = 0; j < m; j++) {
+               temp[start + j] = t[j];
+            }
+         }
+         if (speedSound) {
+            for (std::size_t j = 0; j < m; j++) {
+               speedSound[start + j] = std::sqrt(1.4 * 287.01 * t[j]);
+            }
+         }
+      }
+      if (pressure) {
+         for (std::size_t j = 0; j < m; j++) {
+            const int k{index[j]};
+            pressure[start + j] = press[k] + (press[k + 1] - press[k]) * remainder[j];
+         }
+      }
+      if (rho) {
+         for (std::size_t j = 0; j < m; j++) {
+            const int k{index[j]};
+            rho[start + j] = dens[k] + (dens[k + 1] - dens[k]) * remainder[j];
+         }
+      }
+   }
+}
+
+//
+// 1976 standard atmosphere: temperature is piecewise linear in altitude, and
+// pressure follows the hydrostatic equation within each layer
+//
+AtmosphereData Atmosphere::getAllISA(const double alt_meters)
+{
+   // layer base altitude (m), temperature (K), pressure (Pa) and lapse rate (K/m)
+   static const double base[] = {0, 11000, 20000, 32000, 47000, 51000, 71000};
+   static const double baseTemp[] = {288.15, 216.65, 216.65, 228.65, 270.65, 270.65, 214.65};
+   static const double basePress[] = {101325.0, 22632.06, 5474.889, 868.0187,
+                                      110.9063, 66.93887, 3.956420};
+   static const double lapse[] = {-0.0065, 0.0, 0.001, 0.0028, 0.0, -0.0028, -0.002};
+   const double R{287.053}; // J/(kg K)
+   const double g0{9.80665};
+
+   int layer{};
+   while (layer < 6 && alt_meters >= base[layer + 1]) {
+      layer++;
+   }
+
+   const double h{alt_meters - base[layer]};
+   AtmosphereData x;
+   x.temp = baseTemp[layer] + lapse[layer] * h;
+
+   double p{};
+   if (lapse[layer] == 0.0) {
+      p = basePress[layer] * std::exp(-g0 * h / (R * baseTemp[layer]));
+   } else {
+      p = basePress[layer] * std::pow(x.temp / baseTemp[layer], -g0 / (R * lapse[layer]));
+   }
+
+   // pressure in the units of the table (hPa)
+   x.pressure = p / 100.0;
+   x.rho = p / (R * x.temp);
+   x.speedSound = getSpeedSound(x.temp);
+   return x;
+}
+
+Atmosphere::Model Atmosphere::getModel(const Player& player)
+{
+   const Atmosphere* const atmosphere{player.getAtmosphere()};
+   return atmosphere ? atmosphere->model : Model::TABLE;
+}
+
+AtmosphereData Atmosphere::getAll(const Model model, const double alt_meters)
+{
+   return model == Model::ISA ? getAllISA(alt_meters) : getAll(alt_meters);
+}
+
+void Atmosphere::getAll(const Model model, const std::size_t n, const double alt_meters[],
+                        double temp[], double pressure[], double rho[], double speedSound[])
+{
+   if (model != Model::ISA) {
+      getAll(n, alt_meters, temp, pressure, rho, speedSound);
+      return;
+   }
+   for (std::size_t i = 0; i < n; i++) {
+      const AtmosphereData x{getAllISA(alt_meters[i])};
+      if (temp) {
+         temp[i] = x.temp;
+      }
+      if (pressure) {
+         pressure[i] = x.pressure;
+      }
+      if (rho) {
+         rho[i] = x.rho;
+      }
+      if (speedSound) {
+         speedSound[i] = x.speedSound;
+      }
+   }
+}
+
+double Atmosphere::getSpeedSound(const Model model, const double alt_meters)
+{
+   return model == Model::ISA ? getAllISA(alt_meters).speedSound
+                              : getSpeedSound(getTemp(alt_meters));
+}
 }
 }
@@ -25,7 +25,7 @@ void AutoPilot::update(const double timestep)
       player->pqrdot.multiply(0);
 
       if (player->autoPilotCmds.isOrbitHoldOn()) {
-         updateHdg(timestep, player->eulers.getPsi() +
+         updateHdg(timestep, player->getEulers().getPsi() +
                                  math::PI / 2.0 *
                                      UnitConvert::signum(player->autoPilotCmds.getMaxBank()));
          updateAlt(timestep);
@@ -53,7 +53,7 @@ void AutoPilot::updateHdg(const double timestep, const double cmdHdg)
    if (turnType == TurnType::TRAJECTORY) {
       hdgDiff = cmdHdg - std::atan2(player->nedVel.get2(), player->nedVel.get1());
    } else {
-      hdgDiff = cmdHdg - player->eulers.getPsi();
+      hdgDiff = cmdHdg - player->getEulers().getPsi();
    }
 
    // if hdgDiff > 180, turn opp dir by making hdgDiff neg num <180
@@ -66,7 +66,7 @@ void AutoPilot::updateHdg(const double timestep, const double cmdHdg)
 
    // bound pCmd to -maxBankRate...maxBankRate
    const double pCmd =
-       std::min(maxBankRate, std::max(-maxBankRate, phiCmd - player->eulers.getPhi()));
+       std::min(maxBankRate, std::max(-maxBankRate, phiCmd - player->getEulers().getPhi()));
 
    player->pqr.set1(pCmd);
 }
@@ -84,8 +84,8 @@ void AutoPilot::updateAlt(const double timestep)
 void AutoPilot::updateVS(const double timestep, const double cmdVs)
 {
    const double u = player->uvw.get1();
-   const double phi = player->eulers.getPhi();
-   const double theta = player->eulers.getTheta();
+   const double phi = player->getEulers().getPhi();
+   const double theta = player->getEulers().getTheta();
    const double q = player->pqr.get2();
    const double thetaDenom =
        player->autoPilotCmds.getMaxPitchUp() - player->autoPilotCmds.getMaxPitchDown();
@@ -136,7 +136,7 @@ void AutoPilot::updateVS(const double timestep, const double cmdVs)
    //        dq = min(dq, dqmax);
    //
    //        // check for max pitch angles
-   //        //double pitch = player->eulers.getTheta();
+   //        //double pitch = player->getEulers().getTheta();
    //        //if (pitch > player->autoPilotCmds.getMaxPitchUp() && qCmd > 0) qCmd = 0;
    //        //if ( pitch < player->autoPilotCmds.getMaxPitchDown() && qCmd < 0) qCmd = 0;
    //
@@ -151,7 +151,7 @@ void AutoPilot::updateSpeed(const double timestep)
    double cmdVel = player->autoPilotCmds.getCmdSpeed();
    if (player->autoPilotCmds.isUsingMach()) {
       cmdVel = player->autoPilotCmds.getCmdMach() *
-               Atmosphere::getSpeedSound(Atmosphere::getTemp(player->alt));
+               Atmosphere::getSpeedSound(Atmosphere::getModel(*player), player->alt);
    }
 
    const double dV = (cmdVel - player->uvw.get1()) - player->uvwdot.get1() * spoolTime;
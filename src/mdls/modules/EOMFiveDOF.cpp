@@ -10,21 +10,48 @@
 
 #include "sflight/mdls/nav_utils.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 
 namespace sflight {
 namespace mdls {
 
+namespace {
+// positions in the state
+enum : std::size_t { U, V, W, P, Q, R, EO, EX, EY, EZ, LAT, LON, ALT, X, Y, Z, SIZE };
+
+// Dormand-Prince 5(4): stage coefficients, fifth order weights and the
+// difference between the fifth and fourth order weights (the error estimate)
+const double dpA[6][6]{
+    {1. / 5},
+    {3. / 40, 9. / 40},
+    {44. / 45, -56. / 15, 32. / 9},
+    {19372. / 6561, -25360. / 2187, 64448. / 6561, -212. / 729},
+    {9017. / 3168, -355. / 33, 46732. / 5247, 49. / 176, -5103. / 18656},
+    {35. / 384, 0, 500. / 1113, 125. / 192, -2187. / 6784, 11. / 84}};
+const double dpE[7]{71. / 57600,  0, -71. / 16695, 71. / 1920, -17253. / 339200,
+                    22. / 525, -1. / 40};
+}
+
 EOMFiveDOF::EOMFiveDOF(Player* player, const double frameRate) : Module(player, frameRate) {}
 
-void EOMFiveDOF::update(const double timestep) { computeEOM(timestep); }
+void EOMFiveDOF::update(const double timestep)
+{
+   if (integrator == Integrator::EULER) {
+      computeEOM(timestep);
+   } else {
+      integrate(timestep);
+   }
+}
 
 void EOMFiveDOF::computeEOM(const double timestep)
 {
    const double mass = player->mass;
 
-   quat.initialize(player->eulers);
+   // the attitude is carried from frame to frame, normalized
+   Quaternion attitude{player->getAttitude()};
 
    // quat.getUVW(player->uvw, player->nedVel);
 
@@ -44,8 +71,8 @@ void EOMFiveDOF::computeEOM(const double timestep)
                         player->pqr.get1() * player->uvw.get2());
 
    // get gravity acceleration for current orientation
-   nav::getGravForce(&gravAccel, player->eulers.getTheta(), player->eulers.getPhi(),
-                     nav::getG(player->lat, player->lon, player->alt));
+   attitude.getDown(gravAccel);
+   gravAccel.multiply(nav::getG(player->lat, player->lon, player->alt));
 
    // set the "g" term in the player
    player->g = (player->uvwdot.get3() + gravAccel.get3()) / gravConst;
@@ -78,7 +105,7 @@ void EOMFiveDOF::computeEOM(const double timestep)
 
    // test for on ground condition and prevent downward accel if true
    if (player->altagl < 0) {
-      if (player->eulers.getTheta() < 0) {
+      if (player->getEulers().getTheta() < 0) {
          player->pqr.set2(player->pqr.get2() > 0 ? player->pqr.get2() : 0);
       }
       player->uvw.set3(player->uvw.get3() < 0 ? player->uvw.get3() : 0);
@@ -91,14 +118,13 @@ void EOMFiveDOF::computeEOM(const double timestep)
    player->pqr.add(pqr);
 
    // adjust the quaternion based on the body angular rates
-   const double psi = player->eulers.getPsi();
-   quat.getQdot(qdot, player->pqr.get1(), player->pqr.get2(), player->pqr.get3());
+   attitude.getQdot(qdot, player->pqr.get1(), player->pqr.get2(), player->pqr.get3());
    qdot.multiply(timestep);
-   quat.add(qdot);
-   quat.getEulers(player->eulers);
+   attitude.add(qdot);
+   player->setAttitude(attitude);
 
    // compute the north, east, down velocities
-   quat.getDxDyDz(player->nedVel, player->uvw);
+   attitude.getDxDyDz(player->nedVel, player->uvw);
 
    // add steady-state wind vel to air velocity
    player->nedVel.add(player->windVel);
@@ -119,7 +145,265 @@ void EOMFiveDOF::computeEOM(const double timestep)
 
    // set the mach number
    player->mach =
-       player->vInf / Atmosphere::getSpeedSound(Atmosphere::getTemp(player->alt));
+       player->vInf / Atmosphere::getSpeedSound(Atmosphere::getModel(*player), player->alt);
+}
+
+void EOMFiveDOF::integrate(const double timestep)
+{
+   State x;
+   getState(x);
+
+   // the player reports the accelerations at the start of the frame
+   State k1;
+   Vector3 accel;
+   double g{};
+   getRates(x, k1, &accel, &g);
+
+   switch (integrator) {
+   case Integrator::RK2:              stepRK2(x, k1, timestep);            break;
+   case Integrator::RK4:              stepRK4(x, k1, timestep);            break;
+   case Integrator::ADAMS_BASHFORTH:  stepAdamsBashforth(x, k1, timestep); break;
+   case Integrator::ADAPTIVE:         stepAdaptive(x, k1, timestep);       break;
+   default:                                                                break;
+   }
+
+   setState(x, accel, g);
+}
+
+void EOMFiveDOF::getRates(const State& x, State& dx, Vector3* const accel, double* const g)
+{
+   const double u{x[U]};
+   const double v{x[V]};
+   const double w{x[W]};
+   const double p{x[P]};
+   const double q{x[Q]};
+
+   // within a step the quaternion drifts from unit length; rotate with a unit one
+   const Quaternion attitude(x[EO], x[EX], x[EY], x[EZ]);
+   Quaternion unit{attitude};
+   unit.normalize();
+   unit.getDown(gravAccel);
+   gravAccel.multiply(nav::getG(x[LAT], x[LON], x[ALT]));
+
+   Vector3::add(forces, player->aeroForce, player->thrust);
+   forces.multiply(1. / player->mass);
+
+   // with auto rudder the yaw rate cancels the side acceleration (no-slip)
+   const double side{gravAccel.get2() + forces.get2()};
+   const double r{autoRudder ? std::asin(side / std::sqrt(u * u + v * v + w * w)) : x[R]};
+
+   dx[U] = r * v - q * w + gravAccel.get1() + forces.get1();
+   dx[V] = autoRudder ? 0 : -r * u + p * w + side;
+   dx[W] = q * u - p * v + gravAccel.get3() + forces.get3();
+
+   dx[P] = player->pqrdot.get1();
+   dx[Q] = player->pqrdot.get2();
+   dx[R] = autoRudder ? 0 : player->pqrdot.get3();
+
+   Quaternion rate;
+   attitude.getQdot(rate, p, q, r);
+   dx[EO] = rate.getEo();
+   dx[EX] = rate.getEx();
+   dx[EY] = rate.getEy();
+   dx[EZ] = rate.getEz();
+
+   const Vector3 body(u, v, w);
+   Vector3 ned;
+   unit.getDxDyDz(ned, body);
+   ned.add(player->windVel);
+
+   nav::wgs84LatLonRates(x[LAT], x[ALT], ned.get1(), ned.get2(), &dx[LAT], &dx[LON]);
+   dx[ALT] = -ned.get3();
+   dx[X] = ned.get1();
+   dx[Y] = ned.get2();
+   dx[Z] = ned.get3();
+
+   if (accel) {
+      accel->set1(dx[U]);
+      accel->set2(autoRudder ? side : dx[V]);
+      accel->set3(dx[W]);
+   }
+   if (g) {
+      *g = (q * u - p * v + gravAccel.get3()) / gravConst;
+   }
+}
+
+void EOMFiveDOF::getState(State& x)
+{
+   const Quaternion& attitude{player->getAttitude()};
+
+   x[U] = player->uvw.get1();
+   x[V] = player->uvw.get2();
+   x[W] = player->uvw.get3();
+   x[P] = player->pqr.get1();
+   x[Q] = player->pqr.get2();
+   x[R] = player->pqr.get3();
+   x[EO] = attitude.getEo();
+   x[EX] = attitude.getEx();
+   x[EY] = attitude.getEy();
+   x[EZ] = attitude.getEz();
+   x[LAT] = player->lat;
+   x[LON] = player->lon;
+   x[ALT] = player->alt;
+   x[X] = player->xyz.get1();
+   x[Y] = player->xyz.get2();
+   x[Z] = player->xyz.get3();
+}
+
+void EOMFiveDOF::setState(const State& x, const Vector3& accel, const double g)
+{
+   player->uvwdot = accel;
+   player->g = g;
+
+   player->uvw = Vector3(x[U], x[V], x[W]);
+   player->pqr = Vector3(x[P], x[Q], x[R]);
+
+   Quaternion attitude(x[EO], x[EX], x[EY], x[EZ]);
+   attitude.normalize();
+   player->setAttitude(attitude);
+
+   // compute the new aero angles
+   player->vInf = player->uvw.magnitude();
+   player->alpha = std::atan2(player->uvw.get3(), player->uvw.get1());
+   player->beta = std::asin(player->uvw.get2() / player->vInf);
+   player->alphaDot = std::atan2(player->uvwdot.get3(), player->uvw.get1());
+   player->betaDot = std::asin(player->uvwdot.get2() / player->vInf);
+
+   // adjust yaw rate to match change in beta (no-slip condition)
+   if (autoRudder) {
+      player->pqr.set3(player->betaDot);
+      player->beta = 0;
+      player->uvw.set2(0);
+   }
+
+   // test for on ground condition and prevent downward accel if true
+   if (player->altagl < 0) {
+      if (player->getEulers().getTheta() < 0) {
+         player->pqr.set2(player->pqr.get2() > 0 ? player->pqr.get2() : 0);
+      }
+      player->uvw.set3(player->uvw.get3() < 0 ? player->uvw.get3() : 0);
+      player->uvwdot.set3(player->uvwdot.get3() < 0 ? player->uvwdot.get3() : 0);
+   }
+
+   // compute the north, east, down velocities
+   attitude.getDxDyDz(player->nedVel, player->uvw);
+   player->nedVel.add(player->windVel);
+
+   player->lat = x[LAT];
+   player->lon = x[LON];
+   player->alt = x[ALT];
+   player->xyz = Vector3(x[X], x[Y], x[Z]);
+
+   // set the mach number
+   player->mach =
+       player->vInf / Atmosphere::getSpeedSound(Atmosphere::getModel(*player), player->alt);
+}
+
+void EOMFiveDOF::stepRK2(State& x, const State& k1, const double h)
+{
+   State y;
+   State k2;
+   for (std::size_t i = 0; i < SIZE; i++) {
+      y[i] = x[i] + h * k1[i];
+   }
+   getRates(y, k2);
+   for (std::size_t i = 0; i < SIZE; i++) {
+      x[i] += h / 2 * (k1[i] + k2[i]);
+   }
+}
+
+void EOMFiveDOF::stepRK4(State& x, const State& k1, const double h)
+{
+   State y;
+   State k2;
+   State k3;
+   State k4;
+   for (std::size_t i = 0; i < SIZE; i++) {
+      y[i] = x[i] + h / 2 * k1[i];
+   }
+   getRates(y, k2);
+   for (std::size_t i = 0; i < SIZE; i++) {
+      y[i] = x[i] + h / 2 * k2[i];
+   }
+   getRates(y, k3);
+   for (std::size_t i = 0; i < SIZE; i++) {
+      y[i] = x[i] + h * k3[i];
+   }
+   getRates(y, k4);
+   for (std::size_t i = 0; i < SIZE; i++) {
+      x[i] += h / 6 * (k1[i] + 2 * k2[i] + 2 * k3[i] + k4[i]);
+   }
+}
+
+void EOMFiveDOF::stepAdamsBashforth(State& x, const State& k1, const double h)
+{
+   if (h != lastStep) {
+      steps = 0;
+   }
+   if (steps < 2) {
+      stepRK4(x, k1, h);
+   } else {
+      for (std::size_t i = 0; i < SIZE; i++) {
+         x[i] += h / 12 * (23 * k1[i] - 16 * history[0][i] + 5 * history[1][i]);
+      }
+   }
+   history[1] = history[0];
+   history[0] = k1;
+   steps = std::min<std::size_t>(steps + 1, 2);
+   lastStep = h;
+}
+
+void EOMFiveDOF::stepAdaptive(State& x, const State& k1, const double timestep)
+{
+   // errors in lat and lon are measured in meters
+   State scale;
+   scale.fill(1);
+   scale[LAT] = nav::radiusEq;
+   scale[LON] = nav::radiusEq;
+
+   State k[7];
+   k[0] = k1;
+   State y;
+   double h{substep > 0 ? substep : timestep};
+   double t{};
+   while (t < timestep) {
+      const double remaining{timestep - t};
+      const double step{h < remaining ? h : remaining};
+
+      for (std::size_t s = 0; s < 6; s++) {
+         for (std::size_t i = 0; i < SIZE; i++) {
+            double sum{};
+            for (std::size_t j = 0; j <= s; j++) {
+               sum += dpA[s][j] * k[j][i];
+            }
+            y[i] = x[i] + step * sum;
+         }
+         // the last stage is the rate at the end of the substep
+         getRates(y, k[s + 1]);
+      }
+
+      double error{};
+      for (std::size_t i = 0; i < SIZE; i++) {
+         double e{};
+         for (std::size_t j = 0; j < 7; j++) {
+            e += dpE[j] * k[j][i];
+         }
+         error = std::max(error, std::abs(step * e) * scale[i] / tolerance);
+      }
+
+      // substeps too short to matter are taken whatever their error
+      if (error <= 1 || step <= timestep * 1e-6) {
+         x = y;
+         k[0] = k[6];
+         t = step == remaining ? timestep : t + step;
+      }
+
+      const double factor{error > 0 ? 0.9 * std::pow(error, -0.2) : 5};
+      const double next{step * std::min(5.0, std::max(0.2, factor))};
+      // a substep cut short by the end of the frame says little about the next
+      h = step < h && next > step ? h : next;
+   }
+   substep = h;
 }
 }
 }
@@ -0,0 +1,119 @@
+
+#include "sflight/mdls/modules/EOMSixDOF.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+
+#include "sflight/mdls/Inertia.hpp"
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/Quaternion.hpp"
+#include "sflight/mdls/Vector3.hpp"
+
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <cmath>
+
+namespace sflight {
+namespace mdls {
+
+EOMSixDOF::EOMSixDOF(Player* player, const double frameRate) : Module(player, frameRate) {}
+
+void EOMSixDOF::update(const double timestep) { computeEOM(timestep); }
+
+void EOMSixDOF::computeEOM(const double timestep)
+{
+   Quaternion attitude{player->getAttitude()};
+
+   const double u{player->uvw.get1()};
+   const double v{player->uvw.get2()};
+   const double w{player->uvw.get3()};
+   const double p{player->pqr.get1()};
+   const double q{player->pqr.get2()};
+   const double r{player->pqr.get3()};
+
+   // gravity for the current orientation, in body axes
+   Vector3 gravAccel;
+   attitude.getDown(gravAccel);
+   gravAccel.multiply(nav::getG(player->lat, player->lon, player->alt));
+
+   // accelerations from the rotating frame, gravity, and the aero and propulsion forces
+   const double massInv{1. / player->mass};
+   player->uvwdot.set1(r * v - q * w + gravAccel.get1() +
+                        (player->aeroForce.get1() + player->thrust.get1()) * massInv);
+   player->uvwdot.set2(p * w - r * u + gravAccel.get2() +
+                        (player->aeroForce.get2() + player->thrust.get2()) * massInv);
+   player->uvwdot.set3(q * u - p * v + gravAccel.get3() +
+                        (player->aeroForce.get3() + player->thrust.get3()) * massInv);
+
+   // set the "g" term in the player
+   player->g = (q * u - p * v + gravAccel.get3()) / gravConst;
+
+   // angular accels from the moments, less the gyroscopic term pqr x I pqr
+   const Inertia& inertia{player->inertia};
+   if (inertia.isValid()) {
+      Vector3 momentum;
+      inertia.multiply(momentum, player->pqr);
+      const Vector3 net(
+          player->aeroMoment.get1() + player->thrustMoment.get1() -
+              (q * momentum.get3() - r * momentum.get2()),
+          player->aeroMoment.get2() + player->thrustMoment.get2() -
+              (r * momentum.get1() - p * momentum.get3()),
+          player->aeroMoment.get3() + player->thrustMoment.get3() -
+              (p * momentum.get2() - q * momentum.get1()));
+      inertia.solve(player->pqrdot, net);
+   } else {
+      player->pqrdot = Vector3();
+   }
+
+   // compute new velocity vector and body rates
+   player->uvw.set1(u + player->uvwdot.get1() * timestep);
+   player->uvw.set2(v + player->uvwdot.get2() * timestep);
+   player->uvw.set3(w + player->uvwdot.get3() * timestep);
+   player->pqr.set1(p + player->pqrdot.get1() * timestep);
+   player->pqr.set2(q + player->pqrdot.get2() * timestep);
+   player->pqr.set3(r + player->pqrdot.get3() * timestep);
+
+   // compute the new aero angles
+   player->vInf = player->uvw.magnitude();
+   player->alpha = std::atan2(player->uvw.get3(), player->uvw.get1());
+   player->beta = std::asin(player->uvw.get2() / player->vInf);
+   player->alphaDot = std::atan2(player->uvwdot.get3(), player->uvw.get1());
+   player->betaDot = std::asin(player->uvwdot.get2() / player->vInf);
+
+   // test for on ground condition and prevent downward accel if true
+   if (player->altagl < 0) {
+      if (player->getEulers().getTheta() < 0) {
+         player->pqr.set2(player->pqr.get2() > 0 ? player->pqr.get2() : 0);
+      }
+      player->uvw.set3(player->uvw.get3() < 0 ? player->uvw.get3() : 0);
+      player->uvwdot.set3(player->uvwdot.get3() < 0 ? player->uvwdot.get3() : 0);
+   }
+
+   // adjust the quaternion based on the body angular rates
+   Quaternion qdot;
+   attitude.getQdot(qdot, player->pqr.get1(), player->pqr.get2(), player->pqr.get3());
+   qdot.multiply(timestep);
+   attitude.add(qdot);
+   player->setAttitude(attitude);
+
+   // compute the north, east, down velocities, with the steady-state wind
+   attitude.getDxDyDz(player->nedVel, player->uvw);
+   player->nedVel.add(player->windVel);
+
+   // integrate velocities to get new lat, lon
+   nav::wgs84LatLon(&player->lat, &player->lon, player->alt, player->nedVel.get1(),
+                    player->nedVel.get2(), timestep);
+
+   // update the position in x-y-z space
+   player->xyz.set1(player->xyz.get1() + player->nedVel.get1() * timestep);
+   player->xyz.set2(player->xyz.get2() + player->nedVel.get2() * timestep);
+   player->xyz.set3(player->xyz.get3() + player->nedVel.get3() * timestep);
+
+   // set the new alt (positive vel is downward)
+   player->alt = player->alt - player->nedVel.get3() * timestep;
+
+   // set the mach number
+   player->mach =
+       player->vInf / Atmosphere::getSpeedSound(Atmosphere::getModel(*player), player->alt);
+}
+}
+}
@@ -27,8 +27,9 @@ void Engine::update(const double timestep)
       return;
    }
 
-   double airRatio = (Atmosphere::getTemp(player->alt)) *
-                     Atmosphere::getPressure(player->alt) / seaLevelTemp / seaLevelPress;
+   const AtmosphereData atmos{
+       Atmosphere::getAll(Atmosphere::getModel(*player), player->alt)};
+   double airRatio = atmos.temp * atmos.pressure / seaLevelTemp / seaLevelPress;
 
    // player->rpm = player->rpm + (player->throttle - player->rpm) /
    // timeConst;
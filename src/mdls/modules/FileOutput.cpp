@@ -2,55 +2,65 @@
 #include "sflight/mdls/modules/FileOutput.hpp"
 
 #include "sflight/mdls/Player.hpp"
-#include "sflight/mdls/UnitConvert.hpp"
+#include "sflight/mdls/Telemetry.hpp"
 
 #include <iostream>
-#include <iomanip>
 
 namespace sflight {
 namespace mdls {
 
 FileOutput::FileOutput(Player* player, const double frameRate) : Module(player, frameRate) {}
 
-FileOutput::~FileOutput() { fout.close(); }
+FileOutput::~FileOutput()
+{
+   fout.close();
+   telemetry.close();
+}
 
 void FileOutput::update(const double timestep)
 {
+   if (!opened) {
+      open();
+   }
    if (player->simTime - lastTime > 1.0 / rate) {
       update();
       lastTime = player->simTime;
    }
 }
 
-void FileOutput::update()
+void FileOutput::open()
 {
-   frameCounter++;
+   opened = true;
+   packed.resize(channels.size());
+   values.resize(channels.size());
+   if (format == Format::BINARY) {
+      telemetry.open(filename, channels);
+      return;
+   }
+   fout.open(filename.c_str());
+   if (fout.is_open()) {
+      writeTextHeader(fout, channels);
+      fout << '\n';
+   }
+}
 
-   frameCounter = 0;
+void FileOutput::update()
+{
+   // frameCounter counts output frames, for decimation
+   const std::size_t frame{static_cast<std::size_t>(frameCounter++)};
 
+   if (telemetry.isOpen()) {
+      telemetry.write(packed.data(), channels.gather(*player, frame, packed.data()));
+      return;
+   }
    if (!fout.is_open()) {
       return;
    }
 
-   fout << std::fixed;
-   fout << std::setprecision(3);
-
-   fout << std::setw(14) << player->simTime;
-
-   fout << std::setprecision(4);
-
-   fout << std::setw(14) << UnitConvert::toDegs(player->lat);
-   fout << std::setw(14) << UnitConvert::toDegs(player->lon);
-   fout << std::setw(14) << UnitConvert::toFeet(player->alt);
-
-   fout << std::setw(14) << UnitConvert::toKnots(player->vInf);
-
-   fout << std::setw(14) << UnitConvert::toDegs(player->eulers.getPhi());
-   fout << std::setw(14) << UnitConvert::toDegs(player->eulers.getTheta());
-   fout << std::setw(14) << UnitConvert::toDegs(player->eulers.getPsi());
-
-   fout << std::setw(14) << player->throttle;
-   fout << std::endl;
+   channels.gather(*player, frame, packed.data());
+   channels.scatter(frame, packed.data(), values.data());
+   writeText(fout, channels, values.data());
+   fout << '\n';
 }
 }
 }
@@ -36,6 +36,21 @@ void InterpAero::update(const double timestep)
 
    WindAxis::windToBody(player->aeroForce, player->alpha, player->beta, cl * qbar, cd * qbar,
                         cy * qbar);
+
+   if (hasMoments) {
+      const double spanRate = wingSpan / (2.0 * player->vInf);
+      const double chordRate = chord / (2.0 * player->vInf);
+      player->aeroMoment.set1(qbar * wingSpan *
+                              (clBeta * player->beta + clP * player->pqr.get1() * spanRate +
+                               clAileron * player->deflections.get1()));
+      player->aeroMoment.set2(qbar * chord *
+                              (cmAlpha * (player->alpha - cruiseAlpha) +
+                               cmQ * player->pqr.get2() * chordRate +
+                               cmElevator * player->deflections.get2()));
+      player->aeroMoment.set3(qbar * wingSpan *
+                              (cnBeta * player->beta + cnR * player->pqr.get3() * spanRate +
+                               cnRudder * player->deflections.get3()));
+   }
 }
 
 void InterpAero::createCoefs(const double theta, const double thrust, const double vz,
@@ -62,7 +77,7 @@ void InterpAero::createCoefs(const double theta, const double thrust, const doub
    cd = -aero.get2() / wingArea;
 }
 
-double InterpAero::getBetaMach(const double x) const
+double InterpAero::getBetaMach(const double x)
 {
    double mach {x};
    // if (mach > 1.02 ) return 1 + std::sqrt( mach * mach - 1.0);
@@ -29,14 +29,14 @@ void StickControl::update(const double timestep)
    // std::cout << "qRatio: " << qRatio << std::endl;
 
 //   double desPitch = elevGain * -player->deflections.get1() * qbar /
-//                     designQbar * std::cos(player->eulers.getPhi());
+//                     designQbar * std::cos(player->getEulers().getPhi());
 
    double pitchMom = (1.0 - qRatio) * pitchGain *
-                     std::cos(player->eulers.getTheta()) *
-                     std::cos(player->eulers.getPhi());
+                     std::cos(player->getEulers().getTheta()) *
+                     std::cos(player->getEulers().getPhi());
    double yawMom = (1.0 - qRatio) * pitchGain *
-                   std::cos(player->eulers.getTheta()) *
-                   std::sin(player->eulers.getPhi());
+                   std::cos(player->getEulers().getTheta()) *
+                   std::sin(player->getEulers().getPhi());
 
    player->pqrdot.set1(player->deflections.get2() * ailGain * qRatio -
                         player->pqr.get1());
@@ -4,8 +4,6 @@
 #include "sflight/mdls/modules/Atmosphere.hpp"
 
 #include "sflight/mdls/Player.hpp"
-#include "sflight/mdls/Table2D.hpp"
-#include "sflight/mdls/Table3D.hpp"
 #include "sflight/mdls/UnitConvert.hpp"
 #include "sflight/mdls/Vector3.hpp"
 #include "sflight/mdls/WindAxis.hpp"
@@ -18,24 +16,30 @@ namespace mdls {
 
 TableAero::TableAero(Player* player, const double frameRate) : Module(player, frameRate) {}
 
+// the tables go with the last of this module and the batch modules sharing them
+TableAero::~TableAero() = default;
+
 void TableAero::update(const double timestep)
 {
    if (player == nullptr)
       return;
 
-   double cl = liftTable->interp(player->mach, player->alt, player->alpha);
-   double cd = dragTable->interp(player->mach, player->alt, cl);
+   double x[3]{player->mach, player->alt, player->alpha};
+   double cl = liftTable->interp(x);
+   x[2] = cl;
+   double cd = dragTable->interp(x);
 
    double qbarS = 0.5 * player->vInf * player->vInf * player->rho * wingArea;
 
    WindAxis::windToBody(player->aeroForce, player->alpha, player->beta, cl * qbarS, cd * qbarS,
                         0);
 
-   player->fuelflow = thrustTable->interp(player->mach, player->alt, player->throttle);
+   const double engine[3]{player->throttle, player->alt, player->mach};
+   player->fuelflow = fuelflowTable->interp(engine);
    player->fuel = player->fuel - player->fuelflow * timestep;
    player->mass = player->mass - player->fuelflow * timestep;
 
-   double thrust = thrustTable->interp(player->mach, player->alt, player->throttle);
+   double thrust = thrustTable->interp(engine);
    player->thrust.set1(thrust * std::cos(thrustAngle));
    player->thrust.set2(0);
    player->thrust.set3(-thrust * std::sin(thrustAngle));
@@ -18,8 +18,23 @@ bool wgs84LatLon(double* const lat, double* const lon, const double alt, const d
    if (!lat || !lon)
       return false;
 
+   double dLat{};
+   double dLon{};
+   wgs84LatLonRates(*lat, alt, vn, ve, &dLat, &dLon);
+
+   *lat = *lat + dLat * time_diff;
+   *lon = *lon + dLon * time_diff;
+   return true;
+}
+
+bool wgs84LatLonRates(const double lat, const double alt, const double vn, const double ve,
+                      double* const dLat, double* const dLon)
+{
+   if (!dLat || !dLon)
+      return false;
+
    const double divisor =
-       std::sqrt(1 - epsilon * epsilon * std::sin(*lat) * std::sin(*lat));
+       std::sqrt(1 - epsilon * epsilon * std::sin(lat) * std::sin(lat));
 
    const double rMeridian =
        radiusEq * (1. - epsilon * epsilon) / std::pow(divisor, 3.0);
@@ -30,12 +45,9 @@ bool wgs84LatLon(double* const lat, double* const lon, const double alt, const d
 
    // double g = gravEq * ( 1 + gravConst * std::sin(lat) * std::sin(lat)) / divisor;
 
-   const double dLat = vn / (rMeridian + alt);
+   *dLat = vn / (rMeridian + alt);
 
-   const double dLon = ve / ((rNormal + alt) * std::cos(*lat));
-
-   *lat = *lat + dLat * time_diff;
-   *lon = *lon + dLon * time_diff;
+   *dLon = ve / ((rNormal + alt) * std::cos(lat));
    return true;
 }
 
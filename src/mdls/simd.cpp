@@ -0,0 +1,77 @@
+
+#include "sflight/mdls/simd.hpp"
+
+#if defined(SFLIGHT_SIMD_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace sflight {
+namespace mdls {
+namespace simd {
+
+namespace {
+
+InstructionSet detect()
+{
+#if defined(SFLIGHT_SIMD_X86) && defined(__GNUC__)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f")) {
+      return InstructionSet::AVX512;
+   }
+   if (__builtin_cpu_supports("avx2")) {
+      return InstructionSet::AVX2;
+   }
+   return InstructionSet::SSE2;
+#elif defined(SFLIGHT_SIMD_X86) && defined(_MSC_VER)
+   int info[4]{};
+   __cpuid(info, 0);
+   const int maxLeaf{info[0]};
+
+   __cpuid(info, 1);
+   const bool osxsave{(info[2] & (1 << 27)) != 0};
+   if (!osxsave || maxLeaf < 7) {
+      return InstructionSet::SSE2;
+   }
+
+   // the operating system must save the ymm (and zmm) registers on context switches
+   const unsigned long long xcr0{_xgetbv(0)};
+   const bool avxState{(xcr0 & 0x6) == 0x6};
+   const bool avx512State{(xcr0 & 0xe6) == 0xe6};
+
+   __cpuidex(info, 7, 0);
+   if (avx512State && (info[1] & (1 << 16)) != 0) {
+      return InstructionSet::AVX512;
+   }
+   if (avxState && (info[1] & (1 << 5)) != 0) {
+      return InstructionSet::AVX2;
+   }
+   return InstructionSet::SSE2;
+#else
+   return InstructionSet::SCALAR;
+#endif
+}
+}
+
+InstructionSet getInstructionSet()
+{
+   static const InstructionSet isa{detect()};
+   return isa;
+}
+
+const char* toString(const InstructionSet isa)
+{
+   switch (isa) {
+   case InstructionSet::SSE2:
+      return "sse2";
+   case InstructionSet::AVX2:
+      return "avx2";
+   case InstructionSet::AVX512:
+      return "avx512";
+   default:
+      return "scalar";
+   }
+}
+}
+}
+}
@@ -0,0 +1,43 @@
+
+#include "sflight/xml/Arena.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace sflight {
+namespace xml {
+
+void* Arena::allocate(const std::size_t size, const std::size_t align)
+{
+   std::uintptr_t address{reinterpret_cast<std::uintptr_t>(next)};
+   std::uintptr_t start{(address + align - 1) / align * align};
+
+   if (next == nullptr || size + (start - address) > static_cast<std::size_t>(end - next)) {
+      // a new block, larger than usual if need be
+      const std::size_t n{size + align > blockSize ? size + align : blockSize};
+      blocks.emplace_back(new char[n]);
+      next = blocks.back().get();
+      end = next + n;
+      address = reinterpret_cast<std::uintptr_t>(next);
+      start = (address + align - 1) / align * align;
+   }
+
+   next += (start - address) + size;
+   return reinterpret_cast<void*>(start);
+}
+
+StringView Arena::copy(const StringView& x)
+{
+   char* data{static_cast<char*>(allocate(x.size() > 0 ? x.size() : 1, 1))};
+   std::memcpy(data, x.data(), x.size());
+   return StringView(data, x.size());
+}
+
+void Arena::clear()
+{
+   blocks.clear();
+   next = nullptr;
+   end = nullptr;
+}
+}
+}
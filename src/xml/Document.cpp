@@ -0,0 +1,271 @@
+
+#include "sflight/xml/Document.hpp"
+
+#include "sflight/xml/parser_utils.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace sflight {
+namespace xml {
+
+namespace {
+
+bool startsWith(const char* p, const char* end, const char* search)
+{
+   const std::size_t n{std::strlen(search)};
+   return static_cast<std::size_t>(end - p) >= n && std::memcmp(p, search, n) == 0;
+}
+
+// first occurrence of 'search' in [p, end), or end
+const char* find(const char* p, const char* end, const char* search)
+{
+   while (p < end) {
+      const char* x{static_cast<const char*>(std::memchr(p, search[0], end - p))};
+      if (x == nullptr) {
+         return end;
+      }
+      if (startsWith(x, end, search)) {
+         return x;
+      }
+      p = x + 1;
+   }
+   return end;
+}
+
+// just past the first occurrence of 'search' in [p, end), or end
+const char* skipPast(const char* p, const char* end, const char* search)
+{
+   const char* x{find(p, end, search)};
+   return x == end ? end : x + std::strlen(search);
+}
+
+const char* skipWhitespace(const char* p, const char* end)
+{
+   while (p < end && isWhitespace(*p)) {
+      p++;
+   }
+   return p;
+}
+
+// end of a tag or attribute name
+const char* skipName(const char* p, const char* end)
+{
+   while (p < end && !isWhitespace(*p) && *p != '=' && *p != '/' && *p != '>') {
+      p++;
+   }
+   return p;
+}
+
+// FNV-1a
+std::size_t hashName(const StringView& x)
+{
+   std::uint64_t h{14695981039346656037ull};
+   for (std::size_t i = 0; i < x.size(); i++) {
+      h ^= static_cast<unsigned char>(x[i]);
+      h *= 1099511628211ull;
+   }
+   return static_cast<std::size_t>(h);
+}
+}
+
+Document::~Document() { clear(); }
+
+void Document::clear()
+{
+   for (std::size_t i = 0; i < adopted.size(); i++) {
+      delete adopted[i];
+   }
+   adopted.clear();
+   names.clear();
+   numNames = 0;
+   arena.clear();
+   root = nullptr;
+}
+
+bool Document::load(const std::string& filename)
+{
+   std::ifstream fin(filename, std::ifstream::binary | std::ifstream::ate);
+   if (!fin) {
+      std::cerr << "Could not open file : " << filename << std::endl;
+      return false;
+   }
+   std::cout << "Opened configuration file : " << filename << std::endl;
+
+   size = static_cast<std::size_t>(fin.tellg());
+   fin.seekg(0);
+   buffer.reset(new char[size]);
+   if (!fin.read(buffer.get(), size)) {
+      std::cerr << "Could not read file : " << filename << std::endl;
+      return false;
+   }
+   return parse();
+}
+
+bool Document::parse(const std::string& text)
+{
+   size = text.size();
+   buffer.reset(new char[size]);
+   std::memcpy(buffer.get(), text.data(), size);
+   return parse();
+}
+
+bool Document::parse()
+{
+   clear();
+
+   const char* p{buffer.get()};
+   const char* const end{p + size};
+
+   // innermost open element, and where its text would start
+   Node* node{};
+   const char* textStart{p};
+
+   while (p < end) {
+      const char* tag{static_cast<const char*>(std::memchr(p, '<', end - p))};
+      if (tag == nullptr) {
+         break;
+      }
+
+      // declarations, comments, cdata sections and instructions are skipped
+      if (startsWith(tag, end, "<?")) {
+         p = skipPast(tag, end, "?>");
+      } else if (startsWith(tag, end, "<!--")) {
+         p = skipPast(tag + 4, end, "-->");
+      } else if (startsWith(tag, end, "<![CDATA[")) {
+         p = skipPast(tag, end, "]]>");
+      } else if (startsWith(tag, end, "<!")) {
+         p = skipPast(tag, end, ">");
+      } else if (startsWith(tag, end, "</")) {
+         const char* nameEnd{skipName(tag + 2, end)};
+         const char* close{find(nameEnd, end, ">")};
+         if (close == end) {
+            break;
+         }
+         if (node != nullptr) {
+            const char* text{skipWhitespace(textStart, tag)};
+            node->textView = StringView(text, tag - text);
+            node->readValue();
+            // the root stays current, as with parse()
+            if (node->tagView == StringView(tag + 2, nameEnd - (tag + 2)) &&
+                node->parentNode != nullptr) {
+               node = node->parentNode;
+            }
+         }
+         p = close + 1;
+      } else {
+         const char* name{tag + 1};
+         const char* nameEnd{skipName(name, end)};
+         Node* element{addNode(node, StringView(name, nameEnd - name), StringView())};
+         if (root == nullptr) {
+            root = element;
+         }
+
+         // attributes: name="value" or name='value'
+         p = skipWhitespace(nameEnd, end);
+         while (p < end && *p != '/' && *p != '>') {
+            const char* attrName{p};
+            const char* attrNameEnd{skipName(p, end)};
+            p = skipWhitespace(attrNameEnd, end);
+            if (p == end || *p != '=' || attrNameEnd == attrName) {
+               break;
+            }
+            p = skipWhitespace(p + 1, end);
+            if (p == end || (*p != '"' && *p != '\'')) {
+               break;
+            }
+            const char* value{p + 1};
+            const char* valueEnd{static_cast<const char*>(std::memchr(value, *p, end - value))};
+            if (valueEnd == nullptr) {
+               p = end;
+               break;
+            }
+            addNode(element, StringView(attrName, attrNameEnd - attrName),
+                    StringView(value, valueEnd - value));
+            p = skipWhitespace(valueEnd + 1, end);
+         }
+
+         const char* close{find(p, end, ">")};
+         if (close == end) {
+            break;
+         }
+         if (close[-1] != '/') {
+            node = element;
+         }
+         p = close + 1;
+      }
+      textStart = p;
+   }
+
+   return root != nullptr;
+}
+
+Node* Document::addNode(Node* const parent, const StringView& tagName, const StringView& text)
+{
+   Node* node{arena.create<Node>(intern(tagName), text)};
+   node->document = this;
+   if (parent != nullptr) {
+      parent->addChild(node);
+   }
+   return node;
+}
+
+StringView Document::intern(const StringView& x)
+{
+   // kept at most half full
+   if (2 * (numNames + 1) > names.size()) {
+      std::vector<StringView> old(names.empty() ? 64 : 2 * names.size(),
+                                  StringView(nullptr, 0));
+      old.swap(names);
+      for (std::size_t i = 0; i < old.size(); i++) {
+         if (old[i].data() != nullptr) {
+            std::size_t j{hashName(old[i]) & (names.size() - 1)};
+            while (names[j].data() != nullptr) {
+               j = (j + 1) & (names.size() - 1);
+            }
+            names[j] = old[i];
+         }
+      }
+   }
+
+   std::size_t i{hashName(x) & (names.size() - 1)};
+   while (names[i].data() != nullptr) {
+      if (names[i] == x) {
+         return names[i];
+      }
+      i = (i + 1) & (names.size() - 1);
+   }
+   // an empty name still needs an address of its own
+   names[i] = x.data() != nullptr ? x : StringView("", 0);
+   numNames++;
+   return names[i];
+}
+
+const char* Document::lookup(const StringView& x) const
+{
+   if (names.empty()) {
+      return nullptr;
+   }
+   std::size_t i{hashName(x) & (names.size() - 1)};
+   while (names[i].data() != nullptr) {
+      if (names[i] == x) {
+         return names[i].data();
+      }
+      i = (i + 1) & (names.size() - 1);
+   }
+   return nullptr;
+}
+
+void Document::release(Node* const x)
+{
+   for (std::size_t i = 0; i < adopted.size(); i++) {
+      if (adopted[i] == x) {
+         adopted.erase(adopted.begin() + i);
+         return;
+      }
+   }
+}
+}
+}
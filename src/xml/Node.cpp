@@ -1,56 +1,210 @@
-
 #include "sflight/xml/Node.hpp"
 
+#include "sflight/xml/Arena.hpp"
+#include "sflight/xml/Document.hpp"
+
 #include <algorithm>
-#include <iostream>
-#include <iterator>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
 #include <string>
 #include <vector>
 
 namespace sflight {
 namespace xml {
 
+namespace {
+
+// children looked up by scanning below this count
+const std::size_t indexThreshold{8};
+
+// splits 'path' at the first "/" into its first tag and the rest
+StringView splitPath(const StringView& path, StringView& tail)
+{
+   const char* split{static_cast<const char*>(std::memchr(path.data(), '/', path.size()))};
+   if (split == nullptr) {
+      tail = StringView();
+      return path;
+   }
+   const std::size_t n{static_cast<std::size_t>(split - path.data())};
+   tail = StringView(split + 1, path.size() - n - 1);
+   return StringView(path.data(), n);
+}
+
+std::size_t hashKey(const char* key)
+{
+   const std::uint64_t x{static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key))};
+   return static_cast<std::size_t>((x * 0x9E3779B97F4A7C15ull) >> 32);
+}
+}
+
+//------------------------------------------------------------------------------
+// Class: ChildIndex
+// Description: Open addressing table from the interned tag name of a node's
+//              children to the first child with that name; later children
+//              with the same name are chained through Node::nextSameTag.
+//              Kept at most half full; added children are inserted in place.
+//------------------------------------------------------------------------------
+class ChildIndex
+{
+ public:
+   class Slot
+   {
+    public:
+      const char* key{};
+      Node* first{};
+      Node* last{};
+   };
+
+   Slot* find(const char* key) const
+   {
+      std::size_t i{hashKey(key) & mask};
+      while (slots[i].key != nullptr && slots[i].key != key) {
+         i = (i + 1) & mask;
+      }
+      return &slots[i];
+   }
+
+   // appends 'child' to the chain for its name
+   void insert(Node* const child)
+   {
+      Slot* slot{find(child->tagView.data())};
+      child->nextSameTag = nullptr;
+      if (slot->key == nullptr) {
+         slot->key = child->tagView.data();
+         slot->first = child;
+      } else {
+         slot->last->nextSameTag = child;
+      }
+      slot->last = child;
+   }
+
+   std::size_t mask{};
+   Slot* slots{};
+};
+
+Node::Node(const std::string& x) { setTagName(x); }
+
+Node::Node(const std::string& x, const std::string& y)
+{
+   setTagName(x);
+   setText(y);
+}
+
+Node::Node(const StringView& x, const StringView& y) : tagView(x), textView(y) { readValue(); }
+
 Node::Node(const Node& src)
 {
-   tagName = src.tagName;
-   text = src.text;
+   setTagName(src.getTagName());
+   setText(src.getText());
 
    // copy all children
-   std::size_t cnt = src.getChildCount();
-   for (std::size_t i = 0; i < cnt; i++) {
-      Node* tmp{new Node(*src.getChild(i))};
-      addChild(tmp);
+   for (Node* child = src.firstChild; child != nullptr; child = child->nextSibling) {
+      addChild(new Node(*child));
    }
 }
 
 Node::~Node()
 {
-   for (std::size_t i = childList.size() - 1; i >= 0; i--) {
-      delete childList[i];
+   // children owned by a document are freed with it
+   Node* child{firstChild};
+   while (child != nullptr) {
+      Node* next{child->nextSibling};
+      if (child->document == nullptr) {
+         delete child;
+      }
+      child = next;
+   }
+   delete[] strings;
+}
+
+void Node::setTagName(const std::string& x)
+{
+   if (document != nullptr) {
+      tagView = document->intern(document->arena.copy(x));
+   } else {
+      if (strings == nullptr) {
+         strings = new std::string[2];
+      }
+      strings[0] = x;
+      tagView = strings[0];
+   }
+   if (parentNode != nullptr) {
+      parentNode->updateIndex();
+   }
+}
+
+void Node::setText(const std::string& x)
+{
+   if (document != nullptr) {
+      textView = document->arena.copy(x);
+   } else {
+      if (strings == nullptr) {
+         strings = new std::string[2];
+      }
+      strings[1] = x;
+      textView = strings[1];
+   }
+   readValue();
+}
+
+void Node::readValue()
+{
+   // atof needs the characters null-terminated; a long text is cut, and read
+   // whole only when the number runs up to near the cut
+   char buffer[64];
+   const std::size_t n{std::min(textView.size(), sizeof(buffer) - 1)};
+   std::memcpy(buffer, textView.data(), n);
+   buffer[n] = '\0';
+   char* last{};
+   value = std::strtod(buffer, &last);
+   if (n < textView.size() && last + 16 > buffer + n) {
+      value = std::atof(getText().c_str());
    }
 }
 
 Node* Node::addChild(const std::string& x)
 {
+   if (document != nullptr) {
+      return document->addNode(this, document->arena.copy(x), StringView());
+   }
    Node* child{new Node(x)};
    return addChild(child);
 }
 
 Node* Node::addChild(Node* const x)
 {
-   childList.push_back(x);
+   if (document != nullptr && x->document != document) {
+      foreignChildren = true;
+      if (x->document == nullptr) {
+         document->adopt(x);
+      }
+   }
+   if (lastChild == nullptr) {
+      firstChild = x;
+   } else {
+      lastChild->nextSibling = x;
+   }
+   lastChild = x;
+   x->nextSibling = nullptr;
    x->setParent(this);
+   childCount++;
+   if (index != nullptr && isIndexed() && 2 * childCount <= index->mask + 1) {
+      index->insert(x);
+   } else {
+      updateIndex();
+   }
    return x;
 }
 
-std::size_t Node::getChildCount() const { return childList.size(); }
-
-Node* Node::getChild(const std::size_t index) const
+Node* Node::getChild(const std::size_t x) const
 {
-   if (index < getChildCount())
-      return childList[index];
-
-   return 0;
+   Node* child{firstChild};
+   for (std::size_t i = 0; child != nullptr && i < x; i++) {
+      child = child->nextSibling;
+   }
+   return child;
 }
 
 //
@@ -58,74 +212,141 @@ Node* Node::getChild(const std::size_t index) const
 // if none is found.  To find a nested child, specify the childname
 // as tags separated by "/"
 //
-Node* Node::getChild(const std::string& x) const
+Node* Node::getChild(const std::string& x) const { return getChild(StringView(x)); }
+
+Node* Node::getChild(const StringView& x) const
 {
-   std::string childTagName{x};
+   StringView tail;
+   const StringView childTagName{splitPath(x, tail)};
 
-   const std::size_t splitPt{childTagName.find_first_of("/")};
-   std::string tail;
+   Node* child{findChild(childTagName)};
+   if (child != nullptr && !tail.empty()) {
+      return child->getChild(tail);
+   }
+   return child;
+}
 
-   if (splitPt != std::string::npos) {
-      tail = childTagName.substr(splitPt + 1);
-      childTagName = childTagName.substr(0, splitPt);
+Node* Node::findChild(const StringView& x) const
+{
+   // many children named by this node's document: by interned name
+   if (index != nullptr) {
+      const char* key{document->lookup(x)};
+      if (key == nullptr) {
+         return nullptr;
+      }
+      return index->find(key)->first;
    }
 
-   for (std::size_t i = 0; i < childList.size(); i++) {
-      if (childList[i]->getTagName() == childTagName) {
-         if (tail != "")
-            return childList[i]->getChild(tail);
-         else
-            return childList[i];
+   for (Node* child = firstChild; child != nullptr; child = child->nextSibling) {
+      if (child->tagView == x) {
+         return child;
       }
    }
    return nullptr;
 }
 
+bool Node::isIndexed() const
+{
+   return childCount > indexThreshold && document != nullptr && !foreignChildren;
+}
+
+void Node::updateIndex()
+{
+   if (!isIndexed()) {
+      index = nullptr;
+      return;
+   }
+
+   std::size_t capacity{16};
+   while (capacity < 2 * childCount) {
+      capacity *= 2;
+   }
+
+   ChildIndex* x{document->arena.create<ChildIndex>()};
+   x->mask = capacity - 1;
+   x->slots = static_cast<ChildIndex::Slot*>(
+       document->arena.allocate(capacity * sizeof(ChildIndex::Slot), alignof(ChildIndex::Slot)));
+   for (std::size_t i = 0; i < capacity; i++) {
+      new (&x->slots[i]) ChildIndex::Slot();
+   }
+
+   for (Node* child = firstChild; child != nullptr; child = child->nextSibling) {
+      x->insert(child);
+   }
+   index = x;
+}
+
 //
 // Returns a vector containing all children encountered with specified name, or null
 // if none are found.
 //
 std::vector<Node*> Node::getChildren(const std::string& x) const
 {
-   std::string childName{x};
    std::vector<Node*> list;
+   getChildren(StringView(x), list);
+   return list;
+}
 
-   const Node* tmp{this};
-
-   const std::size_t splitPt{childName.find_first_of("/")};
-   std::string tail;
+void Node::getChildren(const StringView& x, std::vector<Node*>& list) const
+{
+   StringView tail;
+   const StringView childName{splitPath(x, tail)};
 
-   if (splitPt != std::string::npos) {
-      tail = childName.substr(splitPt + 1);
-      childName = childName.substr(0, splitPt);
+   Node* child{};
+   const bool indexed{index != nullptr};
+   if (indexed) {
+      const char* key{document->lookup(childName)};
+      if (key == nullptr) {
+         return;
+      }
+      child = index->find(key)->first;
+   } else {
+      child = firstChild;
+      while (child != nullptr && child->tagView != childName) {
+         child = child->nextSibling;
+      }
    }
 
-   for (std::size_t i = 0; i < tmp->childList.size(); i++) {
-      if (tmp->childList[i]->getTagName() == childName) {
-         if (tail != "") {
-            std::vector<Node*> sublist{childList[i]->getChildren(tail)};
-            for (std::size_t j = 0; j < sublist.size(); j++) {
-               list.push_back(sublist[j]);
-            }
-         } else {
-            list.push_back(childList[i]);
-         }
+   while (child != nullptr) {
+      if (tail.empty()) {
+         list.push_back(child);
+      } else {
+         child->getChildren(tail, list);
+      }
+      if (indexed) {
+         child = child->nextSameTag;
+      } else {
+         do {
+            child = child->nextSibling;
+         } while (child != nullptr && child->tagView != childName);
       }
    }
-
-   return list;
 }
 
 bool Node::remove(Node* const node)
 {
-   std::vector<Node*>::iterator it;
-
-   for (it = childList.begin(); it < childList.end(); it++) {
+   Node* previous{};
+   for (Node* child = firstChild; child != nullptr; child = child->nextSibling) {
+      if (child == node) {
+         if (previous == nullptr) {
+            firstChild = child->nextSibling;
+         } else {
+            previous->nextSibling = child->nextSibling;
+         }
+         if (lastChild == child) {
+            lastChild = previous;
+         }
+         child->nextSibling = nullptr;
+         childCount--;
+         updateIndex();
 
-      if (*it == node) {
-         childList.erase(it);
+         // the caller owns a removed node again
+         if (document != nullptr && child->document == nullptr) {
+            document->release(child);
+         }
          return true;
       }
+      previous = child;
    }
    return false;
 }
@@ -133,9 +354,9 @@ bool Node::remove(Node* const node)
 std::string Node::toString() const
 {
    std::string ret{"<" + getTagName() + ">"};
-   for (std::size_t i = 0; i < childList.size(); i++) {
+   for (Node* child = firstChild; child != nullptr; child = child->nextSibling) {
       ret += "\n";
-      ret += childList[i]->toString();
+      ret += child->toString();
    }
 
    if (getText() != "") {
@@ -0,0 +1,34 @@
+
+#include "sflight/xml/Path.hpp"
+
+#include "sflight/xml/Node.hpp"
+
+#include <string>
+
+namespace sflight {
+namespace xml {
+
+Path::Path(const std::string& x) : path(x)
+{
+   // as with Node::getChild(), a trailing "/" adds nothing
+   std::size_t start{};
+   while (true) {
+      const std::size_t split{path.find('/', start)};
+      tags.push_back(path.substr(start, split - start));
+      if (split == std::string::npos || split + 1 == path.size()) {
+         break;
+      }
+      start = split + 1;
+   }
+}
+
+Node* Path::resolve(Node* const parent) const
+{
+   Node* node{parent};
+   for (std::size_t i = 0; node != nullptr && i < tags.size(); i++) {
+      node = node->findChild(tags[i]);
+   }
+   return node;
+}
+}
+}
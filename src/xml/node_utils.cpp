@@ -6,6 +6,8 @@
 
 #include <cctype>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -13,6 +15,29 @@
 namespace sflight {
 namespace xml {
 
+namespace {
+
+// "true" or "false" in any case, otherwise the default
+bool toBool(const StringView& text, const bool defaultVal)
+{
+   const char* names[]{"TRUE", "FALSE"};
+   for (std::size_t i = 0; i < 2; i++) {
+      const std::size_t n{std::strlen(names[i])};
+      if (text.size() != n) {
+         continue;
+      }
+      std::size_t j{};
+      while (j < n && std::toupper(static_cast<unsigned char>(text[j])) == names[i][j]) {
+         j++;
+      }
+      if (j == n) {
+         return i == 0;
+      }
+   }
+   return defaultVal;
+}
+}
+
 // returns a list of nodes that contain the childName
 std::vector<Node*> getList(Node* const parent, const std::string& childName)
 {
@@ -79,7 +104,7 @@ float getFloat(Node* const parent, const std::string& pathName, const float defa
       return defaultVal;
    }
 
-   return static_cast<float>(std::atof(node->getText().c_str()));
+   return static_cast<float>(node->getValue());
 }
 
 double getDouble(Node* const parent, const std::string& pathName, const double defaultVal)
@@ -94,8 +119,7 @@ double getDouble(Node* const parent, const std::string& pathName, const double d
       return defaultVal;
    }
 
-   const double val{std::atof(node->getText().c_str())};
-   return val;
+   return node->getValue();
 }
 
 bool getBool(Node* const parent, const std::string& pathName, const bool defaultVal)
@@ -109,17 +133,61 @@ bool getBool(Node* const parent, const std::string& pathName, const bool default
       return defaultVal;
    }
 
-   std::string text{node->getText()};
-   for (std::size_t i = 0; i < text.length(); i++) {
-      text[i] = std::toupper(text[i]);
+   return toBool(node->getTextView(), defaultVal);
+}
+
+std::string getString(Node* const parent, const Path& path, const std::string& defaultVal)
+{
+   Node* node{path.resolve(parent)};
+   if (!node) {
+      return defaultVal;
    }
+   return node->getText();
+}
 
-   if (text == "TRUE")
-      return true;
-   if (text == "FALSE")
-      return false;
+int getInt(Node* const parent, const Path& path, const int defaultVal)
+{
+   Node* node{path.resolve(parent)};
+   if (!node) {
+      return defaultVal;
+   }
+   return std::atoi(node->getText().c_str());
+}
 
-   return defaultVal;
+long getLong(Node* const parent, const Path& path, const long defaultVal)
+{
+   Node* node{path.resolve(parent)};
+   if (!node) {
+      return defaultVal;
+   }
+   return std::atol(node->getText().c_str());
+}
+
+float getFloat(Node* const parent, const Path& path, const float defaultVal)
+{
+   Node* node{path.resolve(parent)};
+   if (!node) {
+      return defaultVal;
+   }
+   return static_cast<float>(node->getValue());
+}
+
+double getDouble(Node* const parent, const Path& path, const double defaultVal)
+{
+   Node* node{path.resolve(parent)};
+   if (!node) {
+      return defaultVal;
+   }
+   return node->getValue();
+}
+
+bool getBool(Node* const parent, const Path& path, const bool defaultVal)
+{
+   Node* node{path.resolve(parent)};
+   if (!node) {
+      return defaultVal;
+   }
+   return toBool(node->getTextView(), defaultVal);
 }
 
 std::vector<std::string> splitString(const std::string& inStr, const char splitChar)
@@ -2,12 +2,30 @@
 #include "sflight/xml_bindings/builder.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
+#include "sflight/image/Codec.hpp"
+#include "sflight/image/Writer.hpp"
+
+#include "sflight/mdls/Pipeline.hpp"
 #include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/PlayerBatch.hpp"
+#include "sflight/mdls/Profiler.hpp"
+#include "sflight/mdls/batch/BatchAtmosphere.hpp"
+#include "sflight/mdls/batch/BatchAutoPilot.hpp"
+#include "sflight/mdls/batch/BatchEOMFiveDOF.hpp"
+#include "sflight/mdls/batch/BatchEngine.hpp"
+#include "sflight/mdls/batch/BatchFileOutput.hpp"
+#include "sflight/mdls/batch/BatchInterpAero.hpp"
+#include "sflight/mdls/batch/BatchInverseDesign.hpp"
+#include "sflight/mdls/batch/BatchStickControl.hpp"
+#include "sflight/mdls/batch/BatchTableAero.hpp"
+#include "sflight/mdls/batch/BatchWaypointFollower.hpp"
 #include "sflight/mdls/modules/Atmosphere.hpp"
 #include "sflight/mdls/modules/AutoPilot.hpp"
 #include "sflight/mdls/modules/EOMFiveDOF.hpp"
+#include "sflight/mdls/modules/EOMSixDOF.hpp"
 #include "sflight/mdls/modules/Engine.hpp"
 #include "sflight/mdls/modules/FileOutput.hpp"
 #include "sflight/mdls/modules/InterpAero.hpp"
@@ -16,9 +34,11 @@
 #include "sflight/mdls/modules/TableAero.hpp"
 #include "sflight/mdls/modules/WaypointFollower.hpp"
 
+#include "sflight/xml_bindings/init_Atmosphere.hpp"
 #include "sflight/xml_bindings/init_AutoPilot.hpp"
 #include "sflight/xml_bindings/init_Engine.hpp"
 #include "sflight/xml_bindings/init_EOMFiveDOF.hpp"
+#include "sflight/xml_bindings/init_EOMSixDOF.hpp"
 #include "sflight/xml_bindings/init_FileOutput.hpp"
 #include "sflight/xml_bindings/init_InterpAero.hpp"
 #include "sflight/xml_bindings/init_InverseDesign.hpp"
@@ -29,28 +49,41 @@
 
 #include <iostream>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path modules{"Modules"};
+const xml::Path rate{"Rate"};
+const xml::Path moduleClass{"Class"};
+}
+}
+
 void builder(xml::Node* parent, mdls::Player* player)
 {
    init_Player(parent, player);
 
-   xml::Node* node{parent->getChild("Modules")};
+   xml::Node* node{paths::modules.resolve(parent)};
    std::vector<xml::Node*> nodeList{xml::getList(node, "Module")};
-   const double defaultRate{xml::getDouble(node, "Rate", 0.0)};
+   const double defaultRate{xml::getDouble(node, paths::rate, 0.0)};
 
    for (std::size_t i = 0; i < nodeList.size(); i++) {
 
-      const std::string className{xml::getString(nodeList[i], "Class", "")};
-      const double rate{xml::getDouble(nodeList[i], "Rate", 0.0)};
+      const std::string className{xml::getString(nodeList[i], paths::moduleClass, "")};
+      const double rate{xml::getDouble(nodeList[i], paths::rate, 0.0)};
 
       if (className == "EOMFiveDOF") {
          auto eomFiveDOF{new mdls::EOMFiveDOF(player, rate)};
          player->addModule(eomFiveDOF);
          init_EOMFiveDOF(parent, eomFiveDOF);
+      } else if (className == "EOMSixDOF") {
+         auto eomSixDOF{new mdls::EOMSixDOF(player, rate)};
+         player->addModule(eomSixDOF);
+         init_EOMSixDOF(parent, eomSixDOF);
       } else if (className == "InterpAero") {
          auto interpAero{new mdls::InterpAero(player, rate)};
          player->addModule(interpAero);
@@ -70,6 +103,7 @@ void builder(xml::Node* parent, mdls::Player* player)
       } else if (className == "Atmosphere") {
          auto atmosphere{new mdls::Atmosphere(player, rate)};
          player->addModule(atmosphere);
+         init_Atmosphere(parent, atmosphere);
       } else if (className == "WaypointFollower") {
          auto waypointFollower{new mdls::WaypointFollower(player, rate)};
          player->addModule(waypointFollower);
@@ -88,6 +122,100 @@ void builder(xml::Node* parent, mdls::Player* player)
          init_InverseDesign(parent, inverseDesign);
       }
    }
+
+   // known module configurations run without virtual calls
+   mdls::selectPipeline(player);
+}
+
+namespace {
+// the batch version of a configured module, or null if it has none
+mdls::BatchModule* toBatch(mdls::PlayerBatch* batch, mdls::Module* module)
+{
+   if (auto eom = dynamic_cast<mdls::EOMFiveDOF*>(module)) {
+      // batches only integrate with EULER
+      if (eom->getIntegrator() == mdls::EOMFiveDOF::Integrator::EULER) {
+         return new mdls::BatchEOMFiveDOF(batch, *eom);
+      }
+   } else if (auto interpAero = dynamic_cast<mdls::InterpAero*>(module)) {
+      return new mdls::BatchInterpAero(batch, *interpAero);
+   } else if (auto tableAero = dynamic_cast<mdls::TableAero*>(module)) {
+      return new mdls::BatchTableAero(batch, *tableAero);
+   } else if (auto autoPilot = dynamic_cast<mdls::AutoPilot*>(module)) {
+      return new mdls::BatchAutoPilot(batch, *autoPilot);
+   } else if (auto engine = dynamic_cast<mdls::Engine*>(module)) {
+      return new mdls::BatchEngine(batch, *engine);
+   } else if (auto atmosphere = dynamic_cast<mdls::Atmosphere*>(module)) {
+      return new mdls::BatchAtmosphere(batch, *atmosphere);
+   } else if (auto stickControl = dynamic_cast<mdls::StickControl*>(module)) {
+      return new mdls::BatchStickControl(batch, *stickControl);
+   } else if (auto inverseDesign = dynamic_cast<mdls::InverseDesign*>(module)) {
+      return new mdls::BatchInverseDesign(batch, *inverseDesign);
+   } else if (auto waypointFollower = dynamic_cast<mdls::WaypointFollower*>(module)) {
+      return new mdls::BatchWaypointFollower(batch, *waypointFollower);
+   } else if (auto fileOutput = dynamic_cast<mdls::FileOutput*>(module)) {
+      // binary logs hold the frames of one player
+      if (fileOutput->getFormat() == mdls::FileOutput::Format::TEXT) {
+         return new mdls::BatchFileOutput(batch, *fileOutput);
+      }
+   }
+   return nullptr;
+}
+}
+
+bool builder(xml::Node* parent, mdls::PlayerBatch* batch, const std::size_t count)
+{
+   mdls::Player prototype;
+   builder(parent, &prototype);
+
+   // batch modules are created once and shared by every aircraft in the batch
+   std::vector<mdls::BatchModule*> modules;
+   bool good{true};
+   for (std::size_t i = 0; i < prototype.modules.size(); i++) {
+      mdls::BatchModule* const module{toBatch(batch, prototype.modules[i])};
+      if (module == nullptr) {
+         std::cout << "Module " << mdls::Profiler::getName(*prototype.modules[i])
+                   << " cannot run in a batch with this configuration" << std::endl;
+         good = false;
+      }
+      modules.push_back(module);
+   }
+
+   // the batch modules hold the parameters of one model, so aircraft added to
+   // a batch must be of the model it was built from, module for module
+   std::vector<std::vector<char>> configuration;
+   for (std::size_t i = 0; good && i < prototype.modules.size(); i++) {
+      image::Writer writer;
+      image::Codec::save(writer, prototype.modules[i]);
+      configuration.push_back(writer.getBuffer());
+   }
+   if (good && !batch->modules.empty()) {
+      good = modules.size() == batch->modules.size() &&
+             configuration == batch->configuration;
+      for (std::size_t i = 0; good && i < modules.size(); i++) {
+         good = typeid(*modules[i]) == typeid(*batch->modules[i]) &&
+                modules[i]->frameTime == batch->modules[i]->frameTime;
+      }
+      if (!good) {
+         std::cout << "Model does not match the one the batch was built from" << std::endl;
+      }
+   } else if (good) {
+      for (std::size_t i = 0; i < modules.size(); i++) {
+         batch->addModule(modules[i]);
+      }
+      batch->configuration = configuration;
+      modules.clear();
+   }
+   for (std::size_t i = 0; i < modules.size(); i++) {
+      delete modules[i];
+   }
+   if (!good) {
+      return false;
+   }
+
+   for (std::size_t i = 0; i < count; i++) {
+      batch->add(&prototype);
+   }
+   return true;
 }
 }
 }
@@ -0,0 +1,40 @@
+
+#include "sflight/xml_bindings/init_Atmosphere.hpp"
+
+#include "sflight/mdls/modules/Atmosphere.hpp"
+#include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
+#include "sflight/xml/node_utils.hpp"
+
+#include <iostream>
+#include <string>
+
+namespace sflight {
+namespace xml_bindings {
+
+namespace {
+namespace paths {
+const xml::Path atmosphereModel{"Atmosphere/Model"};
+}
+}
+
+void init_Atmosphere(xml::Node* node, mdls::Atmosphere* atmosphere)
+{
+   std::cout << std::endl;
+   std::cout << "-------------------------" << std::endl;
+   std::cout << "Module: Atmosphere"        << std::endl;
+   std::cout << "-------------------------" << std::endl;
+
+   // <Atmosphere><Model>TABLE | ISA</Model></Atmosphere>
+   const std::string model{xml::getString(node, paths::atmosphereModel, "TABLE")};
+   if (model == "ISA") {
+      atmosphere->model = mdls::Atmosphere::Model::ISA;
+   } else {
+      atmosphere->model = mdls::Atmosphere::Model::TABLE;
+   }
+   std::cout << "Model : " << model << std::endl;
+
+   std::cout << "-------------------------" << std::endl;
+}
+}
+}
@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_AutoPilot.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
@@ -15,6 +16,27 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path autoPilot{"AutoPilot"};
+const xml::Path type{"Type"};
+const xml::Path maxBank{"MaxBank"};
+const xml::Path bankWeight{"BankWeight"};
+const xml::Path maxBankRate{"MaxBankRate"};
+const xml::Path turnType{"TurnType"};
+const xml::Path maxVS{"MaxVS"};
+const xml::Path altWeight{"AltWeight"};
+const xml::Path maxG{"MaxG"};
+const xml::Path minG{"MinG"};
+const xml::Path maxPitchUp{"MaxPitchUp"};
+const xml::Path maxPitchDown{"MaxPitchDown"};
+const xml::Path pitchWeight{"PitchWeight"};
+const xml::Path maxThrottle{"MaxThrottle"};
+const xml::Path minThrottle{"MinThrottle"};
+const xml::Path spoolTime{"SpoolTime"};
+}
+}
+
 void init_AutoPilot(xml::Node* node, mdls::AutoPilot* ap)
 {
    std::cout << std::endl;
@@ -22,34 +44,34 @@ void init_AutoPilot(xml::Node* node, mdls::AutoPilot* ap)
    std::cout << "Module: AutoPilot"         << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   xml::Node* apProps{node->getChild("AutoPilot")};
+   xml::Node* apProps{paths::autoPilot.resolve(node)};
    std::vector<xml::Node*> comps{xml::getList(apProps, "Component")};
 
    for (std::size_t i = 0; i < comps.size(); i++) {
       xml::Node* tmp{comps[i]};
 
-      if (xml::getString(tmp, "Type", "") == "HeadingHold") {
-         ap->player->autoPilotCmds.setMaxBank(mdls::UnitConvert::toRads(xml::getDouble(tmp, "MaxBank", 30.0)));
-         ap->kphi = xml::getDouble(tmp, "BankWeight", ap->kphi);
-         ap->maxBankRate = mdls::UnitConvert::toRads(xml::getDouble(tmp, "MaxBankRate", ap->maxBankRate));
-         ap->turnType = xml::getString(tmp, "TurnType", "").find("TRAJECTORY") == 0
+      if (xml::getString(tmp, paths::type, "") == "HeadingHold") {
+         ap->player->autoPilotCmds.setMaxBank(mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::maxBank, 30.0)));
+         ap->kphi = xml::getDouble(tmp, paths::bankWeight, ap->kphi);
+         ap->maxBankRate = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::maxBankRate, ap->maxBankRate));
+         ap->turnType = xml::getString(tmp, paths::turnType, "").find("TRAJECTORY") == 0
                                    ? mdls::AutoPilot::TurnType::TRAJECTORY
                                    : mdls::AutoPilot::TurnType::HDG;
-      } else if (xml::getString(tmp, "Type", "") == "AltitudeHold") {
-         ap->player->autoPilotCmds.setMaxVS(mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, "MaxVS", 0.0)));
-         ap->kalt = xml::getDouble(tmp, "AltWeight", 0.2);
-      } else if (xml::getString(tmp, "Type", "") == "VSHold") {
-         ap->maxG = (xml::getDouble(tmp, "MaxG", ap->maxG) - 1.0) * mdls::nav::getG(0, 0, 0);
-         ap->minG = (xml::getDouble(tmp, "MinG", ap->minG) - 1.0) * mdls::nav::getG(0, 0, 0);
+      } else if (xml::getString(tmp, paths::type, "") == "AltitudeHold") {
+         ap->player->autoPilotCmds.setMaxVS(mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, paths::maxVS, 0.0)));
+         ap->kalt = xml::getDouble(tmp, paths::altWeight, 0.2);
+      } else if (xml::getString(tmp, paths::type, "") == "VSHold") {
+         ap->maxG = (xml::getDouble(tmp, paths::maxG, ap->maxG) - 1.0) * mdls::nav::getG(0, 0, 0);
+         ap->minG = (xml::getDouble(tmp, paths::minG, ap->minG) - 1.0) * mdls::nav::getG(0, 0, 0);
          ap->maxG_rate = ap->maxG;
          ap->minG_rate = ap->minG;
-         ap->player->autoPilotCmds.setMaxPitchUp(mdls::UnitConvert::toRads(xml::getDouble(tmp, "MaxPitchUp", mdls::math::PI / 2.0)));
-         ap->player->autoPilotCmds.setMaxPitchDown(mdls::UnitConvert::toRads(xml::getDouble(tmp, "MaxPitchDown", -mdls::math::PI / 2.0)));
-         ap->kpitch = xml::getDouble(tmp, "PitchWeight", 0.0);
-      } else if (xml::getString(tmp, "Type", "") == "AutoThrottle") {
-         ap->maxThrottle = xml::getDouble(tmp, "MaxThrottle", ap->maxThrottle);
-         ap->minThrottle = xml::getDouble(tmp, "MinThrottle", ap->minThrottle);
-         ap->spoolTime = xml::getDouble(tmp, "SpoolTime", ap->spoolTime);
+         ap->player->autoPilotCmds.setMaxPitchUp(mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::maxPitchUp, mdls::math::PI / 2.0)));
+         ap->player->autoPilotCmds.setMaxPitchDown(mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::maxPitchDown, -mdls::math::PI / 2.0)));
+         ap->kpitch = xml::getDouble(tmp, paths::pitchWeight, 0.0);
+      } else if (xml::getString(tmp, paths::type, "") == "AutoThrottle") {
+         ap->maxThrottle = xml::getDouble(tmp, paths::maxThrottle, ap->maxThrottle);
+         ap->minThrottle = xml::getDouble(tmp, paths::minThrottle, ap->minThrottle);
+         ap->spoolTime = xml::getDouble(tmp, paths::spoolTime, ap->spoolTime);
       }
    }
 
@@ -4,16 +4,26 @@
 #include "sflight/mdls/modules/EOMFiveDOF.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
 #include "sflight/mdls/nav_utils.hpp"
 
 #include <iostream>
+#include <string>
 
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path controlAutoRudder{"Control/AutoRudder"};
+const xml::Path integrator{"EOMFiveDOF/Integrator"};
+const xml::Path tolerance{"EOMFiveDOF/Tolerance"};
+}
+}
+
 void init_EOMFiveDOF(xml::Node* node, mdls::EOMFiveDOF* eom)
 {
    std::cout << std::endl;
@@ -21,7 +31,6 @@ void init_EOMFiveDOF(xml::Node* node, mdls::EOMFiveDOF* eom)
    std::cout << "Module: EOMFiveDOF"        << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   eom->quat = mdls::Quaternion(eom->player->eulers);
    eom->qdot = mdls::Quaternion();
    eom->forces = mdls::Vector3();
 
@@ -31,10 +40,30 @@ void init_EOMFiveDOF(xml::Node* node, mdls::EOMFiveDOF* eom)
    eom->gravAccel = mdls::Vector3();
 
    eom->gravConst = mdls::nav::getG(0, 0, 0);
-   const bool auto_rudder{xml::getBool(node, "Control/AutoRudder", true)};
+   const bool auto_rudder{xml::getBool(node, paths::controlAutoRudder, true)};
    std::cout << "Auto rudder : " << auto_rudder << std::endl;
    eom->autoRudder = auto_rudder;
 
+   // <EOMFiveDOF><Integrator>EULER | RK2 | RK4 | ADAMS_BASHFORTH | ADAPTIVE</Integrator>
+   //             <Tolerance>0.001</Tolerance></EOMFiveDOF>
+   const std::string integrator{xml::getString(node, paths::integrator, "EULER")};
+   if (integrator == "RK2") {
+      eom->setIntegrator(mdls::EOMFiveDOF::Integrator::RK2);
+   } else if (integrator == "RK4") {
+      eom->setIntegrator(mdls::EOMFiveDOF::Integrator::RK4);
+   } else if (integrator == "ADAMS_BASHFORTH") {
+      eom->setIntegrator(mdls::EOMFiveDOF::Integrator::ADAMS_BASHFORTH);
+   } else if (integrator == "ADAPTIVE") {
+      eom->setIntegrator(mdls::EOMFiveDOF::Integrator::ADAPTIVE);
+   } else {
+      eom->setIntegrator(mdls::EOMFiveDOF::Integrator::EULER);
+   }
+   std::cout << "Integrator  : " << integrator << std::endl;
+   if (eom->getIntegrator() == mdls::EOMFiveDOF::Integrator::ADAPTIVE) {
+      eom->setTolerance(xml::getDouble(node, paths::tolerance, eom->getTolerance()));
+      std::cout << "Tolerance   : " << eom->getTolerance() << std::endl;
+   }
+
    std::cout << "-------------------------" << std::endl;
 }
 }
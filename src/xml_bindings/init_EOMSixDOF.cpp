@@ -0,0 +1,32 @@
+#include "sflight/xml_bindings/init_EOMSixDOF.hpp"
+
+#include "sflight/mdls/modules/EOMSixDOF.hpp"
+
+#include "sflight/xml/Node.hpp"
+
+#include "sflight/mdls/Player.hpp"
+#include "sflight/mdls/nav_utils.hpp"
+
+#include <iostream>
+
+namespace sflight {
+namespace xml_bindings {
+
+void init_EOMSixDOF(xml::Node*, mdls::EOMSixDOF* eom)
+{
+   std::cout << std::endl;
+   std::cout << "-------------------------" << std::endl;
+   std::cout << "Module: EOMSixDOF"         << std::endl;
+   std::cout << "-------------------------" << std::endl;
+
+   eom->gravConst = mdls::nav::getG(0, 0, 0);
+
+   // the inertia is read with the player (<Inertia>)
+   if (!eom->player->inertia.isValid()) {
+      std::cout << "No valid inertia, body rates are held" << std::endl;
+   }
+
+   std::cout << "-------------------------" << std::endl;
+}
+}
+}
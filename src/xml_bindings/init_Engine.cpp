@@ -3,6 +3,7 @@
 
 #include "sflight/mdls/modules/Engine.hpp"
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/modules/Atmosphere.hpp"
@@ -16,6 +17,27 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path design{"Design"};
+const xml::Path designAltitude{"DesignAltitude"};
+const xml::Path thrustAngle{"ThrustAngle"};
+const xml::Path thrustToWeight{"ThrustToWeight"};
+const xml::Path designWeight{"DesignWeight"};
+const xml::Path cruiseConditionFuelFlow{"CruiseCondition/FuelFlow"};
+const xml::Path cruiseConditionMach{"CruiseCondition/Mach"};
+const xml::Path cruiseConditionAirspeed{"CruiseCondition/Airspeed"};
+const xml::Path cruiseConditionThrottle{"CruiseCondition/Throttle"};
+const xml::Path cruiseConditionThrust{"CruiseCondition/Thrust"};
+const xml::Path climbConditionFuelFlow{"ClimbCondition/FuelFlow"};
+const xml::Path climbConditionMach{"ClimbCondition/Mach"};
+const xml::Path climbConditionAirspeed{"ClimbCondition/Airspeed"};
+const xml::Path climbConditionThrottle{"ClimbCondition/Throttle"};
+const xml::Path climbConditionThrust{"ClimbCondition/Thrust"};
+const xml::Path initialConditionsThrottle{"InitialConditions/Throttle"};
+}
+}
+
 void init_Engine(xml::Node* node, mdls::Engine* engine)
 {
    std::cout << std::endl;
@@ -23,9 +45,9 @@ void init_Engine(xml::Node* node, mdls::Engine* engine)
    std::cout << "Module: Engine"            << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   xml::Node* tmp{node->getChild("Design")};
+   xml::Node* tmp{paths::design.resolve(node)};
 
-   const double designAlt{mdls::UnitConvert::toMeters(xml::getDouble(tmp, "DesignAltitude", 0.0))};
+   const double designAlt{mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::designAltitude, 0.0))};
    engine->designRho = mdls::Atmosphere::getRho(designAlt);
    engine->designTemp = mdls::Atmosphere::getTemp(designAlt);
    engine->designPress = mdls::Atmosphere::getPressure(designAlt);
@@ -33,9 +55,9 @@ void init_Engine(xml::Node* node, mdls::Engine* engine)
    double speedSound{mdls::Atmosphere::getSpeedSound(engine->designTemp)};
    double airRatio{engine->designTemp * engine->designPress / engine->seaLevelPress / engine->seaLevelTemp};
 
-   engine->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, "ThrustAngle", 0.0));
+   engine->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::thrustAngle, 0.0));
 
-   double designThrust{xml::getDouble(tmp, "ThrustToWeight", 0.0) * xml::getDouble(tmp, "DesignWeight", 0.0)};
+   double designThrust{xml::getDouble(tmp, paths::thrustToWeight, 0.0) * xml::getDouble(tmp, paths::designWeight, 0.0)};
    engine->designThrust = mdls::UnitConvert::toNewtons(designThrust);
    //   this->designThrust = designThrust;
    designThrust = designThrust / airRatio;
@@ -45,30 +67,30 @@ void init_Engine(xml::Node* node, mdls::Engine* engine)
    std::cout << "design thrust: " << mdls::UnitConvert::toLbsForce(designThrust) << std::endl;
 
    // setup fuel flow slope
-   double ff_1{mdls::UnitConvert::toKilos(xml::getDouble(tmp, "CruiseCondition/FuelFlow", 0.0) / 3600.0)};
-   double mach_1{xml::getDouble(tmp, "CruiseCondition/Mach", 0.0)};
+   double ff_1{mdls::UnitConvert::toKilos(xml::getDouble(tmp, paths::cruiseConditionFuelFlow, 0.0) / 3600.0)};
+   double mach_1{xml::getDouble(tmp, paths::cruiseConditionMach, 0.0)};
    if (mach_1 == 0) {
-      mach_1 = mdls::UnitConvert::toMPS(xml::getDouble(tmp, "CruiseCondition/Airspeed", 0.0)) / speedSound;
+      mach_1 = mdls::UnitConvert::toMPS(xml::getDouble(tmp, paths::cruiseConditionAirspeed, 0.0)) / speedSound;
    }
 
-   double throttle_1{xml::getDouble(tmp, "CruiseCondition/Throttle", 0.0)};
+   double throttle_1{xml::getDouble(tmp, paths::cruiseConditionThrottle, 0.0)};
    if (throttle_1 == 0) {
-      throttle_1 = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "CruiseCondition/Thrust", 0.0)) / designThrust;
+      throttle_1 = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::cruiseConditionThrust, 0.0)) / designThrust;
    }
    ff_1 = ff_1 / throttle_1 / airRatio;
 
    double thrust_1{designThrust / throttle_1 / airRatio};
 
-   double ff_2{mdls::UnitConvert::toKilos(xml::getDouble(tmp, "ClimbCondition/FuelFlow", 0.0) / 3600.0)};
-   double mach_2{xml::getDouble(tmp, "ClimbCondition/Mach", 0.0)};
+   double ff_2{mdls::UnitConvert::toKilos(xml::getDouble(tmp, paths::climbConditionFuelFlow, 0.0) / 3600.0)};
+   double mach_2{xml::getDouble(tmp, paths::climbConditionMach, 0.0)};
 
    if (mach_2 == 0) {
-      mach_2 = mdls::UnitConvert::toMPS(xml::getDouble(tmp, "ClimbCondition/Airspeed", 0.0)) / speedSound;
+      mach_2 = mdls::UnitConvert::toMPS(xml::getDouble(tmp, paths::climbConditionAirspeed, 0.0)) / speedSound;
    }
 
-   double throttle_2{xml::getDouble(tmp, "ClimbCondition/Throttle", 0.0)};
+   double throttle_2{xml::getDouble(tmp, paths::climbConditionThrottle, 0.0)};
    if (throttle_2 == 0) {
-      throttle_2 = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "ClimbCondition/Thrust", 0.0)) / designThrust;
+      throttle_2 = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::climbConditionThrust, 0.0)) / designThrust;
    }
    ff_2 = ff_2 / throttle_2 / airRatio;
 
@@ -78,7 +100,7 @@ void init_Engine(xml::Node* node, mdls::Engine* engine)
    std::cout << "static ff: " << mdls::UnitConvert::toLbs(engine->staticFF) * 3600 * airRatio << std::endl;
 
    // set initial conditions
-   engine->player->throttle = xml::getDouble(node, "InitialConditions/Throttle", 0.0);
+   engine->player->throttle = xml::getDouble(node, paths::initialConditionsThrottle, 0.0);
    engine->player->rpm = engine->player->throttle;
 
    std::cout << "-------------------------" << std::endl;
@@ -2,18 +2,30 @@
 #include "sflight/xml_bindings/init_FileOutput.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
 #include "sflight/mdls/modules/FileOutput.hpp"
 
 #include <iostream>
-#include <fstream>
-#include <iomanip>
+#include <string>
+#include <vector>
 
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path fileOutputPath{"FileOutput/Path"};
+const xml::Path fileOutputRate{"FileOutput/Rate"};
+const xml::Path fileOutputFormat{"FileOutput/Format"};
+const xml::Path fileOutputChannels{"FileOutput/Channels"};
+const xml::Path name{"Name"};
+const xml::Path decimation{"Decimation"};
+}
+}
+
 void init_FileOutput(xml::Node* node, mdls::FileOutput* fileOutput)
 {
    std::cout << std::endl;
@@ -21,26 +33,44 @@ void init_FileOutput(xml::Node* node, mdls::FileOutput* fileOutput)
    std::cout << "Module: FileOutput"        << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   std::string filename{xml::getString(node, "FileOutput/Path", "")};
+   std::string filename{xml::getString(node, paths::fileOutputPath, "")};
    std::cout << "Filename : " << filename << std::endl;
-   fileOutput->fout.open(filename.c_str());
-   if (fileOutput->fout.is_open()) {
-      fileOutput->fout << std::setw(14) << "Time(sec)"
-                       << std::setw(14) << "Lat(deg)"
-                       << std::setw(14) << "Lon(deg)"
-                       << std::setw(14) << "Alt(ft)"
-                       << std::setw(14) << "Speed(ktas)"
-                       << std::setw(14) << "Bank(deg)"
-                       << std::setw(14) << "Pitch(deg)"
-                       << std::setw(14) << "Heading(deg)"
-                       << std::setw(14) << "Throttle"
-                       << std::endl;
-   }
+   fileOutput->filename = filename;
 
-   const double rate{xml::getDouble(node, "FileOutput/Rate", 1.0)};
+   const double rate{xml::getDouble(node, paths::fileOutputRate, 1.0)};
    std::cout << "Rate     : " << rate << std::endl;
    fileOutput->rate = static_cast<int>(rate);
 
+   // <FileOutput><Format>TEXT | BINARY</Format></FileOutput>
+   const std::string format{xml::getString(node, paths::fileOutputFormat, "TEXT")};
+   if (format == "BINARY") {
+      fileOutput->format = mdls::FileOutput::Format::BINARY;
+   } else {
+      fileOutput->format = mdls::FileOutput::Format::TEXT;
+   }
+   std::cout << "Format   : " << format << std::endl;
+
+   // <Channels><Channel Name="Alt" Decimation="10"/>...</Channels>, otherwise the standard columns
+   xml::Node* channelsNode{paths::fileOutputChannels.resolve(node)};
+   if (channelsNode != nullptr) {
+      mdls::Channels channels;
+      std::vector<xml::Node*> channelNodes{xml::getList(channelsNode, "Channel")};
+      for (std::size_t i = 0; i < channelNodes.size(); i++) {
+         const std::string name{xml::getString(channelNodes[i], paths::name, "")};
+         const int decimation{xml::getInt(channelNodes[i], paths::decimation, 1)};
+         if (!channels.add(name, decimation > 0 ? static_cast<std::size_t>(decimation) : 1)) {
+            std::cout << "Unknown channel : " << name << std::endl;
+         }
+      }
+      if (!channels.empty()) {
+         fileOutput->channels = channels;
+      }
+   }
+   for (std::size_t i = 0; i < fileOutput->channels.size(); i++) {
+      std::cout << "Channel  : " << fileOutput->channels.getField(i).getTitle()
+                << " every " << fileOutput->channels.getDecimation(i) << " frame(s)" << std::endl;
+   }
+
    fileOutput->frameCounter = 0;
 
    std::cout << "-------------------------" << std::endl;
@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_InterpAero.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
@@ -17,6 +18,41 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path design{"Design"};
+const xml::Path designAltitude{"DesignAltitude"};
+const xml::Path designWeight{"DesignWeight"};
+const xml::Path wingSpan{"WingSpan"};
+const xml::Path wingArea{"WingArea"};
+const xml::Path thrustAngle{"ThrustAngle"};
+const xml::Path thrustToWeight{"ThrustToWeight"};
+const xml::Path cruiseConditionPitch{"CruiseCondition/Pitch"};
+const xml::Path cruiseConditionAirspeed{"CruiseCondition/Airspeed"};
+const xml::Path cruiseConditionVS{"CruiseCondition/VS"};
+const xml::Path cruiseConditionMach{"CruiseCondition/Mach"};
+const xml::Path cruiseConditionThrust{"CruiseCondition/Thrust"};
+const xml::Path cruiseConditionThrottle{"CruiseCondition/Throttle"};
+const xml::Path climbConditionPitch{"ClimbCondition/Pitch"};
+const xml::Path climbConditionAirspeed{"ClimbCondition/Airspeed"};
+const xml::Path climbConditionVS{"ClimbCondition/VS"};
+const xml::Path climbConditionMach{"ClimbCondition/Mach"};
+const xml::Path climbConditionThrust{"ClimbCondition/Thrust"};
+const xml::Path climbConditionThrottle{"ClimbCondition/Throttle"};
+const xml::Path moments{"Moments"};
+const xml::Path chord{"Chord"};
+const xml::Path clBeta{"ClBeta"};
+const xml::Path clP{"ClP"};
+const xml::Path clAileron{"ClAileron"};
+const xml::Path cmAlpha{"CmAlpha"};
+const xml::Path cmQ{"CmQ"};
+const xml::Path cmElevator{"CmElevator"};
+const xml::Path cnBeta{"CnBeta"};
+const xml::Path cnR{"CnR"};
+const xml::Path cnRudder{"CnRudder"};
+}
+}
+
 void init_InterpAero(xml::Node* node, mdls::InterpAero* iaero)
 {
    std::cout << std::endl;
@@ -24,33 +60,33 @@ void init_InterpAero(xml::Node* node, mdls::InterpAero* iaero)
    std::cout << "Module: InterpAero"        << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   xml::Node* tmp{node->getChild("Design")};
+   xml::Node* tmp{paths::design.resolve(node)};
 
-   iaero->designAlt = mdls::UnitConvert::toMeters(xml::getDouble(tmp, "DesignAltitude", 0.0));
-   iaero->designWeight = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "DesignWeight", 0.0));
+   iaero->designAlt = mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::designAltitude, 0.0));
+   iaero->designWeight = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::designWeight, 0.0));
 
-   iaero->wingSpan = mdls::UnitConvert::toMeters(xml::getDouble(tmp, "WingSpan", 6.0));
-   iaero->wingArea = mdls::UnitConvert::toSqMeters(xml::getDouble(tmp, "WingArea", 6.0));
+   iaero->wingSpan = mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::wingSpan, 6.0));
+   iaero->wingArea = mdls::UnitConvert::toSqMeters(xml::getDouble(tmp, paths::wingArea, 6.0));
 
    iaero->wingEffects = mdls::math::PI * iaero->wingSpan * iaero->wingSpan / iaero->wingArea;
    // wingEffects = 1.0;
 
-   iaero->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, "ThrustAngle", 0.0));
+   iaero->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::thrustAngle, 0.0));
 
-   const double thrustRatio{xml::getDouble(tmp, "ThrustToWeight", 0.0) * iaero->designWeight};
+   const double thrustRatio{xml::getDouble(tmp, paths::thrustToWeight, 0.0) * iaero->designWeight};
    const double speedSound{mdls::Atmosphere::getSpeedSound(mdls::Atmosphere::getTemp(iaero->designAlt))};
 
    // cruise condition
-   double pitch{mdls::UnitConvert::toRads(xml::getDouble(tmp, "CruiseCondition/Pitch", 0.0))};
-   double airspeed{mdls::UnitConvert::toMPS(xml::getDouble(tmp, "CruiseCondition/Airspeed", 0.0))};
-   double vs{mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, "CruiseCondition/VS", 0.0))};
+   double pitch{mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::cruiseConditionPitch, 0.0))};
+   double airspeed{mdls::UnitConvert::toMPS(xml::getDouble(tmp, paths::cruiseConditionAirspeed, 0.0))};
+   double vs{mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, paths::cruiseConditionVS, 0.0))};
    if (airspeed < 1E-6) {
-      airspeed = xml::getDouble(tmp, "CruiseCondition/Mach", 0.0) * speedSound;
+      airspeed = xml::getDouble(tmp, paths::cruiseConditionMach, 0.0) * speedSound;
    }
 
-   double thrust{mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "CruiseCondition/Thrust", 0.0))};
+   double thrust{mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::cruiseConditionThrust, 0.0))};
    if (thrust < 1E-6) {
-      thrust = xml::getDouble(tmp, "CruiseCondition/Throttle", 0.0) * thrustRatio;
+      thrust = xml::getDouble(tmp, paths::cruiseConditionThrottle, 0.0) * thrustRatio;
    }
 
    iaero->createCoefs(pitch, thrust, vs, airspeed, iaero->cruiseAlpha, iaero->cruiseCL, iaero->cruiseCD);
@@ -64,17 +100,17 @@ void init_InterpAero(xml::Node* node, mdls::InterpAero* iaero)
    }
 
    // climb condition
-   pitch = mdls::UnitConvert::toRads(xml::getDouble(tmp, "ClimbCondition/Pitch", 0.0));
-   airspeed = mdls::UnitConvert::toMPS(xml::getDouble(tmp, "ClimbCondition/Airspeed", 0.0));
-   vs = mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, "ClimbCondition/VS", 0.0));
+   pitch = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::climbConditionPitch, 0.0));
+   airspeed = mdls::UnitConvert::toMPS(xml::getDouble(tmp, paths::climbConditionAirspeed, 0.0));
+   vs = mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, paths::climbConditionVS, 0.0));
    if (airspeed < 1E-6) {
-      airspeed = xml::getDouble(tmp, "ClimbCondition/Mach", 0.0) * speedSound;
+      airspeed = xml::getDouble(tmp, paths::climbConditionMach, 0.0) * speedSound;
    }
    mach = airspeed / speedSound;
 
-   thrust = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "ClimbCondition/Thrust", 0.0));
+   thrust = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::climbConditionThrust, 0.0));
    if (thrust < 1E-6) {
-      thrust = xml::getDouble(tmp, "ClimbCondition/Throttle", 0.0) * thrustRatio;
+      thrust = xml::getDouble(tmp, paths::climbConditionThrottle, 0.0) * thrustRatio;
    }
 
    iaero->createCoefs(pitch, thrust, vs, airspeed, iaero->climbAlpha, iaero->climbCL, iaero->climbCD);
@@ -93,6 +129,27 @@ void init_InterpAero(xml::Node* node, mdls::InterpAero* iaero)
                (iaero->cruiseCL * iaero->cruiseCL - iaero->climbCL * iaero->climbCL);
    iaero->b1 = iaero->climbCD - iaero->b2 * iaero->climbCL * iaero->climbCL;
 
+   // <Moments Chord="ft" ClBeta ClP ClAileron CmAlpha CmQ CmElevator CnBeta CnR CnRudder/>
+   // (per radian), for six degree of freedom models
+   xml::Node* moments{paths::moments.resolve(tmp)};
+   if (moments != nullptr) {
+      iaero->hasMoments = true;
+      // the mean chord defaults to the wing area over the span
+      const double chord{mdls::UnitConvert::toMeters(xml::getDouble(moments, paths::chord, 0.0))};
+      iaero->chord = chord > 0 ? chord : iaero->wingArea / iaero->wingSpan;
+      iaero->clBeta = xml::getDouble(moments, paths::clBeta, 0.0);
+      iaero->clP = xml::getDouble(moments, paths::clP, 0.0);
+      iaero->clAileron = xml::getDouble(moments, paths::clAileron, 0.0);
+      iaero->cmAlpha = xml::getDouble(moments, paths::cmAlpha, 0.0);
+      iaero->cmQ = xml::getDouble(moments, paths::cmQ, 0.0);
+      iaero->cmElevator = xml::getDouble(moments, paths::cmElevator, 0.0);
+      iaero->cnBeta = xml::getDouble(moments, paths::cnBeta, 0.0);
+      iaero->cnR = xml::getDouble(moments, paths::cnR, 0.0);
+      iaero->cnRudder = xml::getDouble(moments, paths::cnRudder, 0.0);
+      std::cout << "Moments  : chord " << iaero->chord << " m, Cl beta " << iaero->clBeta
+                << ", Cm alpha " << iaero->cmAlpha << ", Cn beta " << iaero->cnBeta << std::endl;
+   }
+
    std::cout << "-------------------------" << std::endl;
 }
 }
@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_InverseDesign.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
@@ -19,6 +20,29 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path design{"Design"};
+const xml::Path compressibleFlow{"CompressibleFlow"};
+const xml::Path engineThrustAngle{"Engine/ThrustAngle"};
+const xml::Path engineStaticThrust{"Engine/StaticThrust"};
+const xml::Path engineType{"Engine/Type"};
+const xml::Path flightConditionsWeight{"FlightConditions/Weight"};
+const xml::Path flightConditionsWingSpan{"FlightConditions/WingSpan"};
+const xml::Path flightConditionsWingArea{"FlightConditions/WingArea"};
+const xml::Path flightConditionsAltitude{"FlightConditions/Altitude"};
+const xml::Path pitch{"Pitch"};
+const xml::Path airspeed{"Airspeed"};
+const xml::Path vS{"VS"};
+const xml::Path altitude{"Altitude"};
+const xml::Path weight{"Weight"};
+const xml::Path mach{"Mach"};
+const xml::Path throttle{"Throttle"};
+const xml::Path fuelFlow{"FuelFlow"};
+const xml::Path initialConditionsThrottle{"InitialConditions/Throttle"};
+}
+}
+
 void init_InverseDesign(xml::Node* node, mdls::InverseDesign* invDsg)
 {
    std::cout << std::endl;
@@ -26,15 +50,15 @@ void init_InverseDesign(xml::Node* node, mdls::InverseDesign* invDsg)
    std::cout << "Module: InverseDesign"     << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   xml::Node* tmp{node->getChild("Design")};
+   xml::Node* tmp{paths::design.resolve(node)};
 
-   invDsg->usingMachEffects = xml::getBool(tmp, "CompressibleFlow", false);
+   invDsg->usingMachEffects = xml::getBool(tmp, paths::compressibleFlow, false);
 
    // get Engine parameters
-   invDsg->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, "Engine/ThrustAngle", 0.0));
-   invDsg->staticThrust = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "Engine/StaticThrust", 0.0));
+   invDsg->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::engineThrustAngle, 0.0));
+   invDsg->staticThrust = mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::engineStaticThrust, 0.0));
 
-   std::string engineType{xml::getString(tmp, "Engine/Type", "")};
+   std::string engineType{xml::getString(tmp, paths::engineType, "")};
    if (engineType == "Turbojet") {
       invDsg->dTdM = 0;
       invDsg->dTdRho = 1;
@@ -50,10 +74,10 @@ void init_InverseDesign(xml::Node* node, mdls::InverseDesign* invDsg)
    std::vector<xml::Node*> fcNodes{tmp->getChildren("FlightConditions/FlightCondition")};
 
    // get default values
-   invDsg->designWeight = xml::getDouble(tmp, "FlightConditions/Weight", 0.0);
-   invDsg->wingSpan = mdls::UnitConvert::toMeters(xml::getDouble(tmp, "FlightConditions/WingSpan", 6.0));
-   invDsg->wingArea = mdls::UnitConvert::toSqMeters(xml::getDouble(tmp, "FlightConditions/WingArea", 6.0));
-   invDsg->designAlt = xml::getDouble(tmp, "FlightConditions/Altitude", 0.0);
+   invDsg->designWeight = xml::getDouble(tmp, paths::flightConditionsWeight, 0.0);
+   invDsg->wingSpan = mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::flightConditionsWingSpan, 6.0));
+   invDsg->wingArea = mdls::UnitConvert::toSqMeters(xml::getDouble(tmp, paths::flightConditionsWingArea, 6.0));
+   invDsg->designAlt = xml::getDouble(tmp, paths::flightConditionsAltitude, 0.0);
 
    const std::size_t size{fcNodes.size()};
 
@@ -66,26 +90,26 @@ void init_InverseDesign(xml::Node* node, mdls::InverseDesign* invDsg)
    for (std::size_t i = 0; i < size; i++) {
       tmp = fcNodes[i];
 
-      const double pitch{mdls::UnitConvert::toRads(xml::getDouble(tmp, "Pitch", 0.0))};
-      double airspeed{mdls::UnitConvert::toMPS(xml::getDouble(tmp, "Airspeed", 0.0))};
-      const double vs{mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, "VS", 0.0))};
-      const double alt{mdls::UnitConvert::toMeters(xml::getDouble(tmp, "Altitude", invDsg->designAlt))};
+      const double pitch{mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::pitch, 0.0))};
+      double airspeed{mdls::UnitConvert::toMPS(xml::getDouble(tmp, paths::airspeed, 0.0))};
+      const double vs{mdls::UnitConvert::FPMtoMPS(xml::getDouble(tmp, paths::vS, 0.0))};
+      const double alt{mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::altitude, invDsg->designAlt))};
       const double speedSound{mdls::Atmosphere::getSpeedSound(mdls::Atmosphere::getTemp(alt))};
       const double rho{mdls::Atmosphere::getRho(alt)};
-      const double weight{mdls::UnitConvert::toNewtons(xml::getDouble(tmp, "Weight", invDsg->designWeight))};
+      const double weight{mdls::UnitConvert::toNewtons(xml::getDouble(tmp, paths::weight, invDsg->designWeight))};
 
       if (airspeed < 1E-6) {
-         mach[i] = xml::getDouble(tmp, "Mach", 0.0);
+         mach[i] = xml::getDouble(tmp, paths::mach, 0.0);
          airspeed = mach[i] * speedSound;
       } else {
          mach[i] = airspeed / speedSound;
       }
 
-      const double thrust{invDsg->getThrust(rho, mach[i], xml::getDouble(tmp, "Throttle", 0.0))};
+      const double thrust{invDsg->getThrust(rho, mach[i], xml::getDouble(tmp, paths::throttle, 0.0))};
 
       invDsg->getAeroCoefs(pitch, airspeed, vs, rho, weight, thrust, alpha[i], cl[i], cd[i]);
 
-      tsfc[i] = mdls::UnitConvert::toKilos(xml::getDouble(tmp, "FuelFlow", 0.0) / 3600.0) / thrust;
+      tsfc[i] = mdls::UnitConvert::toKilos(xml::getDouble(tmp, paths::fuelFlow, 0.0) / 3600.0) / thrust;
 
       // apply compressibility if used.  this finds the incompressible cl and cd
       // values by deviding by the
@@ -131,7 +155,7 @@ void init_InverseDesign(xml::Node* node, mdls::InverseDesign* invDsg)
    std::cout << "cdo: " << invDsg->cdo << " dCDda: " << invDsg->b << std::endl;
 
    // set initial conditions
-   invDsg->player->throttle = xml::getDouble(node, "InitialConditions/Throttle", 0.0);
+   invDsg->player->throttle = xml::getDouble(node, paths::initialConditionsThrottle, 0.0);
    invDsg->player->rpm = invDsg->player->throttle;
 
    std::cout << "-------------------------" << std::endl;
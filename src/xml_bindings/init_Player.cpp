@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_Player.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Euler.hpp"
@@ -16,6 +17,33 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path initialConditionsWeight{"InitialConditions/Weight"};
+const xml::Path wind{"Wind"};
+const xml::Path speed{"Speed"};
+const xml::Path direction{"Direction"};
+const xml::Path initialConditionsPosition{"InitialConditions/Position"};
+const xml::Path latitude{"Latitude"};
+const xml::Path longitude{"Longitude"};
+const xml::Path altitude{"Altitude"};
+const xml::Path initialConditionsOrientation{"InitialConditions/Orientation"};
+const xml::Path heading{"Heading"};
+const xml::Path pitch{"Pitch"};
+const xml::Path roll{"Roll"};
+const xml::Path initialConditionsAirspeed{"InitialConditions/Airspeed"};
+const xml::Path initialConditionsMach{"InitialConditions/Mach"};
+const xml::Path initialConditionsFuel{"InitialConditions/Fuel"};
+const xml::Path inertia{"Inertia"};
+const xml::Path ixx{"Ixx"};
+const xml::Path iyy{"Iyy"};
+const xml::Path izz{"Izz"};
+const xml::Path ixy{"Ixy"};
+const xml::Path ixz{"Ixz"};
+const xml::Path iyz{"Iyz"};
+}
+}
+
 void init_Player(xml::Node* const node, mdls::Player* player)
 {
    std::cout << std::endl;
@@ -23,13 +51,29 @@ void init_Player(xml::Node* const node, mdls::Player* player)
    std::cout << "Player: InitialConditions" << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   player->mass = mdls::UnitConvert::toKilos(xml::getDouble(node, "InitialConditions/Weight", 0.0));
+   player->mass = mdls::UnitConvert::toKilos(xml::getDouble(node, paths::initialConditionsWeight, 0.0));
    std::cout << "Player mass      : " << player->mass << " Kilograms\n";
 
-   xml::Node* wind{node->getChild("Wind")};
+   // <Inertia Ixx=".." Iyy=".." Izz=".." Ixy=".." Ixz=".." Iyz=".."/> in slug-ft2
+   xml::Node* inertia{paths::inertia.resolve(node)};
+   if (inertia != nullptr) {
+      const bool valid{player->inertia.set(
+          mdls::UnitConvert::toKgSqMeters(xml::getDouble(inertia, paths::ixx, 0.0)),
+          mdls::UnitConvert::toKgSqMeters(xml::getDouble(inertia, paths::iyy, 0.0)),
+          mdls::UnitConvert::toKgSqMeters(xml::getDouble(inertia, paths::izz, 0.0)),
+          mdls::UnitConvert::toKgSqMeters(xml::getDouble(inertia, paths::ixy, 0.0)),
+          mdls::UnitConvert::toKgSqMeters(xml::getDouble(inertia, paths::ixz, 0.0)),
+          mdls::UnitConvert::toKgSqMeters(xml::getDouble(inertia, paths::iyz, 0.0)))};
+      std::cout << "Player inertia   : Ixx " << player->inertia.getIxx() << ", Iyy "
+                << player->inertia.getIyy() << ", Izz " << player->inertia.getIzz() << ", Ixy "
+                << player->inertia.getIxy() << ", Ixz " << player->inertia.getIxz() << ", Iyz "
+                << player->inertia.getIyz() << " kg-m2" << (valid ? "" : " (singular)") << "\n";
+   }
+
+   xml::Node* wind{paths::wind.resolve(node)};
    if (wind != nullptr) {
-      const double wspeed{mdls::UnitConvert::toMPS(xml::getDouble(wind, "Speed", 0.0))};
-      const double dir{mdls::UnitConvert::toRads(xml::getDouble(wind, "Direction", 0.0) + 180)};
+      const double wspeed{mdls::UnitConvert::toMPS(xml::getDouble(wind, paths::speed, 0.0))};
+      const double dir{mdls::UnitConvert::toRads(xml::getDouble(wind, paths::direction, 0.0) + 180)};
       std::cout << "Player wind speed     : " << wspeed << "MPS\n";
       std::cout << "Player wind direction : " << dir << "radians\n";
       player->windVel.set1(wspeed * std::cos(dir));
@@ -37,25 +81,26 @@ void init_Player(xml::Node* const node, mdls::Player* player)
       player->windVel.set3(0);
    }
 
-   xml::Node* tmp{node->getChild("InitialConditions/Position")};
-   player->lat = mdls::UnitConvert::toRads(xml::getDouble(tmp, "Latitude", 0.0));
-   player->lon = mdls::UnitConvert::toRads(xml::getDouble(tmp, "Longitude", 0.0));
-   player->alt = mdls::UnitConvert::toMeters(xml::getDouble(tmp, "Altitude", 0.0));
+   xml::Node* tmp{paths::initialConditionsPosition.resolve(node)};
+   player->lat = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::latitude, 0.0));
+   player->lon = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::longitude, 0.0));
+   player->alt = mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::altitude, 0.0));
    std::cout << "Player latitude  : " << player->lat << " degrees\n";
    std::cout << "Player longitude : " << player->lon << " degrees\n";
    std::cout << "Player altitude  : " << player->alt << " feet\n";
 
-   tmp = node->getChild("InitialConditions/Orientation");
-   const double heading{mdls::UnitConvert::toRads(xml::getDouble(tmp, "Heading", 0.0))};
-   const double pitch{mdls::UnitConvert::toRads(xml::getDouble(tmp, "Pitch", 0.0))};
-   const double roll{mdls::UnitConvert::toRads(xml::getDouble(tmp, "Roll", 0.0))};
+   tmp = paths::initialConditionsOrientation.resolve(node);
+   const double heading{mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::heading, 0.0))};
+   const double pitch{mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::pitch, 0.0))};
+   const double roll{mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::roll, 0.0))};
    std::cout << "Player heading   : " << heading << " degrees\n";
    std::cout << "Player pitch     : " << pitch   << " degrees\n";
    std::cout << "Player roll      : " << roll  << " degrees\n";
-   player->eulers = mdls::Euler(heading, pitch, roll);
+   mdls::Euler eulers(heading, pitch, roll);
+   player->setEulers(eulers);
 
-   const double speed{mdls::UnitConvert::toMPS(xml::getDouble(node, "InitialConditions/Airspeed", 0.0))};
-   const double mach{xml::getDouble(node, "InitialConditions/Mach", 0.0)};
+   const double speed{mdls::UnitConvert::toMPS(xml::getDouble(node, paths::initialConditionsAirspeed, 0.0))};
+   const double mach{xml::getDouble(node, paths::initialConditionsMach, 0.0)};
    std::cout << "Player speed     : " << speed << " MPS\n";
    std::cout << "Player mach      : " << mach  << std::endl;
    if (mach != 0 && speed == 0) {
@@ -64,9 +109,9 @@ void init_Player(xml::Node* const node, mdls::Player* player)
       player->uvw.set1(speed);
    }
 
-   player->eulers.getDxDyDz(player->nedVel, player->uvw);
+   eulers.getDxDyDz(player->nedVel, player->uvw);
 
-   player->autoPilotCmds.setCmdHeading(player->eulers.getPsi());
+   player->autoPilotCmds.setCmdHeading(eulers.getPsi());
    player->autoPilotCmds.setCmdAltitude(player->alt);
    player->autoPilotCmds.setCmdSpeed(player->uvw.get1());
    player->autoPilotCmds.setCmdVertSpeed(0);
@@ -75,7 +120,7 @@ void init_Player(xml::Node* const node, mdls::Player* player)
    player->autoPilotCmds.setAutoThrottleOn(true);
    player->autoPilotCmds.setHdgHoldOn(true);
 
-   const double fuel{mdls::UnitConvert::toKilos(xml::getDouble(node, "InitialConditions/Fuel", 0.0))};
+   const double fuel{mdls::UnitConvert::toKilos(xml::getDouble(node, paths::initialConditionsFuel, 0.0))};
    std::cout << "Player fuel      : " << fuel << std::endl;
    player->fuel = fuel;
    std::cout << "-------------------------" << std::endl;
@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_StickControl.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
@@ -17,6 +18,19 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path control{"Control"};
+const xml::Path designAltitude{"DesignAltitude"};
+const xml::Path designAirspeed{"DesignAirspeed"};
+const xml::Path designPointMach{"DesignPoint/Mach"};
+const xml::Path elevatorGain{"ElevatorGain"};
+const xml::Path aileronGain{"AileronGain"};
+const xml::Path rudderGain{"RudderGain"};
+const xml::Path pitchGain{"PitchGain"};
+}
+}
+
 void init_StickControl(xml::Node* node, mdls::StickControl* sc)
 {
    std::cout << std::endl;
@@ -24,23 +38,23 @@ void init_StickControl(xml::Node* node, mdls::StickControl* sc)
    std::cout << "Module: StickControl"      << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   xml::Node* cntrlNode{node->getChild("Control")};
+   xml::Node* cntrlNode{paths::control.resolve(node)};
 
-   double designAlt{mdls::UnitConvert::toMeters(xml::getDouble(cntrlNode, "DesignAltitude", 0.0))};
+   double designAlt{mdls::UnitConvert::toMeters(xml::getDouble(cntrlNode, paths::designAltitude, 0.0))};
 
-   double designSpeed{mdls::UnitConvert::toMPS(xml::getDouble(cntrlNode, "DesignAirspeed", 0.0))};
+   double designSpeed{mdls::UnitConvert::toMPS(xml::getDouble(cntrlNode, paths::designAirspeed, 0.0))};
    if (designSpeed == 0.0) {
-      designSpeed = xml::getDouble(cntrlNode, "DesignPoint/Mach", 0.0) *
+      designSpeed = xml::getDouble(cntrlNode, paths::designPointMach, 0.0) *
                     mdls::Atmosphere::getSpeedSound(mdls::Atmosphere::getTemp(designAlt));
    }
 
    sc->designQbar = 0.5 * mdls::Atmosphere::getRho(designAlt) * designSpeed * designSpeed;
 
-   sc->elevGain = xml::getDouble(cntrlNode, "ElevatorGain", 20.0);
-   sc->ailGain = xml::getDouble(cntrlNode, "AileronGain", 50.0);
-   sc->rudGain = xml::getDouble(cntrlNode, "RudderGain", 20.0);
+   sc->elevGain = xml::getDouble(cntrlNode, paths::elevatorGain, 20.0);
+   sc->ailGain = xml::getDouble(cntrlNode, paths::aileronGain, 50.0);
+   sc->rudGain = xml::getDouble(cntrlNode, paths::rudderGain, 20.0);
 
-   sc->pitchGain = xml::getDouble(cntrlNode, "PitchGain", 0.0);
+   sc->pitchGain = xml::getDouble(cntrlNode, paths::pitchGain, 0.0);
 
    sc->elevGain = mdls::UnitConvert::toRads(sc->elevGain);
    sc->ailGain = mdls::UnitConvert::toRads(sc->ailGain);
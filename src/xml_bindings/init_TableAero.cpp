@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_TableAero.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
@@ -10,184 +11,173 @@
 #include "sflight/mdls/UnitConvert.hpp"
 #include "sflight/mdls/constants.hpp"
 #include "sflight/mdls/Table2D.hpp"
-#include "sflight/mdls/Table3D.hpp"
+#include "sflight/mdls/TableND.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace sflight {
 namespace xml_bindings {
 
-void init_TableAero(xml::Node* node, mdls::TableAero* tblAero)
-{
-   std::cout << std::endl;
-   std::cout << "-------------------------" << std::endl;
-   std::cout << "Module: TableAero"         << std::endl;
-   std::cout << "-------------------------" << std::endl;
-
-   xml::Node* tmp{node->getChild("Design")};
-   if (!tmp) { return; }
-
-   tblAero->wingSpan = mdls::UnitConvert::toMeters(xml::getDouble(tmp, "WingSpan", 6.0));
-   tblAero->wingArea = mdls::UnitConvert::toSqMeters(xml::getDouble(tmp, "WingArea", 6.0));
-   tblAero->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, "ThrustAngle", 0.0));
+namespace {
+namespace paths {
+const xml::Path design{"Design"};
+const xml::Path wingSpan{"WingSpan"};
+const xml::Path wingArea{"WingArea"};
+const xml::Path thrustAngle{"ThrustAngle"};
+const xml::Path thrustTable{"ThrustTable"};
+const xml::Path fuelFlowTable{"FuelFlowTable"};
+const xml::Path liftTable{"LiftTable"};
+const xml::Path dragTable{"DragTable"};
+}
+}
 
-   xml::Node* thrustNode{tmp->getChild("ThrustTable")};
-   xml::Node* ffNode{tmp->getChild("FuelFlowTable")};
-   xml::Node* liftNode{tmp->getChild("LiftTable")};
-   xml::Node* dragNode{tmp->getChild("DragTable")};
+namespace {
 
-   if (thrustNode) {
+double noConversion(const double x) { return x; }
 
-      std::vector<xml::Node*> tables{thrustNode->getChildren("Table")};
-      const std::size_t numpages{tables.size()};
-      double* throttleVals{new double[numpages]};
-      tblAero->thrustTable = new mdls::Table3D(numpages, throttleVals);
+std::vector<double> getVals(xml::Node* node, const std::string& name, double (*convert)(double))
+{
+   const std::vector<std::string> splits{xml::splitString(xml::getString(node, name, ""), ',')};
+   std::vector<double> vals(splits.size());
+   for (std::size_t i = 0; i < splits.size(); i++) {
+      vals[i] = convert(std::atof(splits[i].c_str()));
+   }
+   return vals;
+}
 
-      for (std::size_t i = 0; i < numpages; i++) {
+std::vector<double> merge(const std::vector<double>& a, const std::vector<double>& b)
+{
+   std::vector<double> vals;
+   std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(vals));
+   vals.erase(std::unique(vals.begin(), vals.end()), vals.end());
+   return vals;
+}
 
-         xml::Node* tablenode{tables[i]};
+//
+// Builds a [page, row, col] table from the <Table> children of 'node'.  Each
+// page is a 2-D table with its own breakpoints; pages are put on the union of
+// all row and column breakpoints, sampling those that lack some of them, which
+// reproduces the piecewise bilinear surface of every page.  An optional
+// <Clamp> list (one 0/1 per axis) clamps queries to the breakpoints instead of
+// extrapolating.
+//
+std::shared_ptr<mdls::TableND<3>> buildTable(xml::Node* node, const std::string& pageName,
+                                             const std::string& rowName,
+                                             double (*rowConvert)(double),
+                                             const std::string& colName,
+                                             double (*colConvert)(double))
+{
+   const std::vector<xml::Node*> tables{node->getChildren("Table")};
+   const std::size_t numPages{tables.size()};
+
+   std::vector<double> pageVals(numPages);
+   std::vector<std::vector<double>> rowVals(numPages);
+   std::vector<std::vector<double>> colVals(numPages);
+   std::vector<double> rows;
+   std::vector<double> cols;
+
+   for (std::size_t i = 0; i < numPages; i++) {
+      pageVals[i] = xml::getDouble(tables[i], pageName, 0.0);
+      rowVals[i] = getVals(tables[i], rowName, rowConvert);
+      colVals[i] = getVals(tables[i], colName, colConvert);
+      rows = merge(rows, rowVals[i]);
+      cols = merge(cols, colVals[i]);
+   }
 
-         throttleVals[i] = xml::getDouble(tables[i], "Throttle", 0.0);
+   std::vector<double> data(numPages * rows.size() * cols.size());
+   for (std::size_t i = 0; i < numPages; i++) {
+      const std::vector<double> pageData{getVals(tables[i], "Data", noConversion)};
+      const std::size_t numRows{rowVals[i].size()};
+      const std::size_t numCols{colVals[i].size()};
+      if (pageData.size() != numRows * numCols) {
+         continue;
+      }
 
-         std::string valstr{xml::getString(tablenode, "AltVals", "")};
-         std::vector<std::string> splits{xml::splitString(valstr, ',')};
-         const std::size_t numAltVals{splits.size()};
+      double* page{&data[i * rows.size() * cols.size()]};
+      if (rowVals[i] == rows && colVals[i] == cols) {
+         std::copy(pageData.begin(), pageData.end(), page);
+         continue;
+      }
 
-         double* altvals{new double[numAltVals]};
-         for (std::size_t j = 0; j < numAltVals; j++) {
-            altvals[j] = mdls::UnitConvert::toMeters(std::atof(splits[j].c_str()));
+      double* rv{new double[numRows]};
+      double* cv{new double[numCols]};
+      std::copy(rowVals[i].begin(), rowVals[i].end(), rv);
+      std::copy(colVals[i].begin(), colVals[i].end(), cv);
+      mdls::Table2D table(numRows, numCols, rv, cv);
+      for (std::size_t j = 0; j < numRows; j++) {
+         for (std::size_t k = 0; k < numCols; k++) {
+            table.set(j, k, pageData[j * numCols + k]);
          }
-
-         valstr = xml::getString(tablenode, "MachVals", "");
-         splits = xml::splitString(valstr, ',');
-         std::size_t numMachVals{splits.size()};
-
-         double* machvals{new double[numMachVals]};
-         for (std::size_t j = 0; j < numMachVals; j++) {
-            machvals[j] = std::atof(splits[j].c_str());
+      }
+      for (std::size_t j = 0; j < rows.size(); j++) {
+         for (std::size_t k = 0; k < cols.size(); k++) {
+            page[j * cols.size() + k] = table.interp(rows[j], cols[k]);
          }
-
-         mdls::Table2D* table{new mdls::Table2D(numAltVals, numMachVals, machvals, altvals)};
-         const std::string data{xml::getString(tablenode, "Data", "")};
-         table->setData(data);
-         tblAero->thrustTable->setPage(i, table);
       }
-      // convert from lbs to Newtons
-      tblAero->thrustTable->multiply(mdls::UnitConvert::toNewtons(1));
-
-      tblAero->thrustTable->print();
    }
 
-   if (ffNode) {
+   auto table = std::make_shared<mdls::TableND<3>>(
+       std::vector<std::vector<double>>{pageVals, rows, cols});
+   table->setData(data);
 
-      std::vector<xml::Node*> tables{ffNode->getChildren("Table")};
-      const std::size_t numpages{tables.size()};
-      double* throttleVals{new double[numpages]};
-      tblAero->fuelflowTable = new mdls::Table3D(numpages, throttleVals);
-
-      for (std::size_t i = 0; i < numpages; i++) {
+   const std::vector<double> clamp{getVals(node, "Clamp", noConversion)};
+   for (std::size_t i = 0; i < clamp.size() && i < table->getRank(); i++) {
+      table->setClamp(i, clamp[i] != 0.0);
+   }
+   return table;
+}
+}
 
-         xml::Node* tablenode{tables[i]};
+void init_TableAero(xml::Node* node, mdls::TableAero* tblAero)
+{
+   std::cout << std::endl;
+   std::cout << "-------------------------" << std::endl;
+   std::cout << "Module: TableAero"         << std::endl;
+   std::cout << "-------------------------" << std::endl;
 
-         throttleVals[i] = xml::getDouble(tables[i], "Throttle", 0.0);
+   xml::Node* tmp{paths::design.resolve(node)};
+   if (!tmp) { return; }
 
-         std::string valstr{getString(tablenode, "AltVals", "")};
-         std::vector<std::string> splits{xml::splitString(valstr, ',')};
-         std::size_t numAltVals{splits.size()};
+   tblAero->wingSpan = mdls::UnitConvert::toMeters(xml::getDouble(tmp, paths::wingSpan, 6.0));
+   tblAero->wingArea = mdls::UnitConvert::toSqMeters(xml::getDouble(tmp, paths::wingArea, 6.0));
+   tblAero->thrustAngle = mdls::UnitConvert::toRads(xml::getDouble(tmp, paths::thrustAngle, 0.0));
 
-         double* altvals{new double[numAltVals]};
-         for (std::size_t j = 0; j < numAltVals; j++) {
-            altvals[j] = mdls::UnitConvert::toMeters(std::atof(splits[j].c_str()));
-         }
+   xml::Node* thrustNode{paths::thrustTable.resolve(tmp)};
+   xml::Node* ffNode{paths::fuelFlowTable.resolve(tmp)};
+   xml::Node* liftNode{paths::liftTable.resolve(tmp)};
+   xml::Node* dragNode{paths::dragTable.resolve(tmp)};
 
-         valstr = xml::getString(tablenode, "MachVals", "");
-         splits = xml::splitString(valstr, ',');
-         const std::size_t numMachVals{splits.size()};
+   if (thrustNode) {
+      tblAero->thrustTable = buildTable(thrustNode, "Throttle", "AltVals", mdls::UnitConvert::toMeters,
+                                        "MachVals", noConversion);
+      // convert from lbs to Newtons
+      tblAero->thrustTable->multiply(mdls::UnitConvert::toNewtons(1));
 
-         double* machvals{new double[numMachVals]};
-         for (std::size_t j = 0; j < numMachVals; j++) {
-            machvals[j] = std::atof(splits[j].c_str());
-         }
+      tblAero->thrustTable->print();
+   }
 
-         mdls::Table2D* table{new mdls::Table2D(numAltVals, numMachVals, altvals, machvals)};
-         table->setData(xml::getString(tablenode, "Data", ""));
-         tblAero->fuelflowTable->setPage(i, table);
-      }
+   if (ffNode) {
+      tblAero->fuelflowTable = buildTable(ffNode, "Throttle", "AltVals", mdls::UnitConvert::toMeters,
+                                          "MachVals", noConversion);
       // convert from lbs/sec to kilos/sec
       tblAero->fuelflowTable->multiply(mdls::UnitConvert::toKilos(1));
    }
 
    if (liftNode != nullptr) {
-
-      std::vector<xml::Node*> tables{liftNode->getChildren("Table")};
-      const std::size_t numpages{tables.size()};
-      double* machVals{new double[numpages]};
-      tblAero->liftTable = new mdls::Table3D(numpages, machVals);
-
-      for (std::size_t i = 0; i < numpages; i++) {
-         xml::Node* tablenode{tables[i]};
-
-         machVals[i] = xml::getDouble(tables[i], "Mach", 0.0);
-
-         std::string valstr{xml::getString(tablenode, "AltVals", "")};
-         std::vector<std::string> splits{xml::splitString(valstr, ',')};
-         const std::size_t numAltVals{splits.size()};
-
-         double* altvals{new double[numAltVals]};
-         for (std::size_t j = 0; j < numAltVals; j++) {
-            altvals[j] = mdls::UnitConvert::toMeters(std::atof(splits[j].c_str()));
-         }
-
-         valstr = xml::getString(tablenode, "AlphaVals", "");
-         splits = xml::splitString(valstr, ',');
-         const std::size_t numAlphaVals{splits.size()};
-
-         double* alphavals{new double[numAlphaVals]};
-         for (std::size_t j = 0; j < numAlphaVals; j++) {
-            alphavals[j] = mdls::UnitConvert::toRads(std::atof(splits[j].c_str()));
-         }
-
-         mdls::Table2D* table{new mdls::Table2D(numAltVals, numAlphaVals, altvals, alphavals)};
-         table->setData(getString(tablenode, "Data", ""));
-         tblAero->liftTable->setPage(i, table);
-      }
+      tblAero->liftTable = buildTable(liftNode, "Mach", "AltVals", mdls::UnitConvert::toMeters,
+                                      "AlphaVals", mdls::UnitConvert::toRads);
    }
 
    if (dragNode != nullptr) {
-      std::vector<xml::Node*> tables{dragNode->getChildren("Table")};
-      const std::size_t numpages{tables.size()};
-      double* machVals{new double[numpages]};
-      tblAero->dragTable = new mdls::Table3D(numpages, machVals);
-
-      for (std::size_t i = 0; i < numpages; i++) {
-
-         xml::Node* tablenode{tables[i]};
-
-         machVals[i] = xml::getDouble(tables[i], "Mach", 0.0);
-
-         std::string valstr{xml::getString(tablenode, "AltVals", "")};
-         std::vector<std::string> splits{xml::splitString(valstr, ',')};
-         const std::size_t numAltVals{splits.size()};
-
-         double* altvals{new double[numAltVals]};
-         for (std::size_t j = 0; j < numAltVals; j++) {
-            altvals[j] = mdls::UnitConvert::toMeters(std::atof(splits[j].c_str()));
-         }
-
-         valstr = xml::getString(tablenode, "CLVals", "");
-         splits = xml::splitString(valstr, ',');
-         const std::size_t numAlphaVals{splits.size()};
-
-         double* alphavals{new double[numAlphaVals]};
-         for (std::size_t j = 0; j < numAlphaVals; j++) {
-            alphavals[j] = std::atof(splits[j].c_str());
-         }
-
-         mdls::Table2D* table{new mdls::Table2D(numAltVals, numAlphaVals, altvals, alphavals)};
-         table->setData(xml::getString(tablenode, "Data", ""));
-         tblAero->dragTable->setPage(i, table);
-      }
+      tblAero->dragTable = buildTable(dragNode, "Mach", "AltVals", mdls::UnitConvert::toMeters,
+                                      "CLVals", noConversion);
    }
 
    std::cout << "-------------------------" << std::endl;
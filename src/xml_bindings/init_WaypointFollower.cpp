@@ -2,6 +2,7 @@
 #include "sflight/xml_bindings/init_WaypointFollower.hpp"
 
 #include "sflight/xml/Node.hpp"
+#include "sflight/xml/Path.hpp"
 #include "sflight/xml/node_utils.hpp"
 
 #include "sflight/mdls/Player.hpp"
@@ -15,6 +16,20 @@
 namespace sflight {
 namespace xml_bindings {
 
+namespace {
+namespace paths {
+const xml::Path waypointFollow{"WaypointFollow"};
+const xml::Path waypointFollower{"WaypointFollower"};
+const xml::Path pathType{"PathType"};
+const xml::Path waypointList{"WaypointList"};
+const xml::Path lat{"Lat"};
+const xml::Path lon{"Lon"};
+const xml::Path alt{"Alt"};
+const xml::Path speed{"Speed"};
+const xml::Path heading{"Heading"};
+}
+}
+
 void init_WaypointFollower(xml::Node* node, mdls::WaypointFollower* wp)
 {
    std::cout << std::endl;
@@ -22,23 +37,23 @@ void init_WaypointFollower(xml::Node* node, mdls::WaypointFollower* wp)
    std::cout << "Module: WaypointFollower"  << std::endl;
    std::cout << "-------------------------" << std::endl;
 
-   xml::Node* tmp{node->getChild("WaypointFollower")};
+   xml::Node* tmp{paths::waypointFollower.resolve(node)};
 
-   wp->isOn = xml::getBool(tmp, "WaypointFollow", true);
+   wp->isOn = xml::getBool(tmp, paths::waypointFollow, true);
 
-   wp->cmdPathType = (xml::getString(tmp, "PathType", "DIRECT") == "BEARING")
+   wp->cmdPathType = (xml::getString(tmp, paths::pathType, "DIRECT") == "BEARING")
                          ? mdls::WaypointFollower::PathType::BEARING
                          : mdls::WaypointFollower::PathType::DIRECT;
 
-   std::vector<xml::Node*> wps{xml::getList(tmp->getChild("WaypointList"), "Waypoint")};
+   std::vector<xml::Node*> wps{xml::getList(paths::waypointList.resolve(tmp), "Waypoint")};
 
    for (std::size_t i = 0; i < wps.size(); i++) {
       xml::Node* wpNode{wps[i]};
-      wp->addWaypoint(mdls::UnitConvert::toRads(xml::getDouble(wpNode, "Lat", 0.0)),
-                      mdls::UnitConvert::toRads(xml::getDouble(wpNode, "Lon", 0.0)),
-                      mdls::UnitConvert::toMeters(xml::getDouble(wpNode, "Alt", 0.0)),
-                      mdls::UnitConvert::toMPS(xml::getDouble(wpNode, "Speed", 0.0)),
-                      mdls::UnitConvert::toRads(xml::getDouble(wpNode, "Heading", 0.0)));
+      wp->addWaypoint(mdls::UnitConvert::toRads(xml::getDouble(wpNode, paths::lat, 0.0)),
+                      mdls::UnitConvert::toRads(xml::getDouble(wpNode, paths::lon, 0.0)),
+                      mdls::UnitConvert::toMeters(xml::getDouble(wpNode, paths::alt, 0.0)),
+                      mdls::UnitConvert::toMPS(xml::getDouble(wpNode, paths::speed, 0.0)),
+                      mdls::UnitConvert::toRads(xml::getDouble(wpNode, paths::heading, 0.0)));
    }
 
    if (wp->isOn) {